@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Flourish/Core/Assert.h"
+#include "Flourish/Api/Context.h"
 
 namespace Flourish
 {
@@ -153,6 +154,10 @@ namespace Flourish
         u32 InitialDataSize = 0; // Bytes
         bool ExposeGPUAddress = false;
 
+        // Used for memory accounting
+        MemoryCategory Category = MemoryCategory::Buffer;
+        std::string DebugName;
+
         // Only used when populating initial data
         // TODO: this is more of a temporary solution, a better one would be to
         // always defer the initial data upload
@@ -23,11 +23,27 @@ namespace Flourish
         return buffer;
     }
 
+    const char* MemoryCategoryToString(MemoryCategory category)
+    {
+        switch (category)
+        {
+            case MemoryCategory::Buffer: return "Buffer";
+            case MemoryCategory::Staging: return "Staging";
+            case MemoryCategory::Texture: return "Texture";
+            case MemoryCategory::RenderTarget: return "RenderTarget";
+            case MemoryCategory::MsaaRenderTarget: return "MsaaRenderTarget";
+            case MemoryCategory::AccelerationStructure: return "AccelerationStructure";
+            case MemoryCategory::ShaderBindingTable: return "ShaderBindingTable";
+            case MemoryCategory::Transient: return "Transient";
+            default: return "Unknown";
+        }
+    }
+
     std::string MemoryStatistics::ToString() const
     {
         char buffer[300];
 
-        std::snprintf(
+        int length = std::snprintf(
             buffer,
             sizeof(buffer),
             "Memory Statistics:\n"
@@ -43,6 +59,63 @@ namespace Flourish
             (float)TotalAvailable / 1e6
         );
 
+        std::string result(buffer, std::min((int)sizeof(buffer) - 1, length));
+        for (u32 i = 0; i < Categories.size(); i++)
+        {
+            auto& category = Categories[i];
+            std::snprintf(
+                buffer,
+                sizeof(buffer),
+                "\n%s: %u allocs, %.1f MB (peak %.1f MB), +%u/-%u last frame",
+                MemoryCategoryToString(static_cast<MemoryCategory>(i)),
+                category.AllocationCount,
+                (float)category.CurrentSize / 1e6,
+                (float)category.PeakSize / 1e6,
+                category.FrameAllocations,
+                category.FrameFrees
+            );
+            result += buffer;
+        }
+
+        return result;
+    }
+
+    std::string FrameStatistics::ToString() const
+    {
+        char buffer[600];
+
+        std::snprintf(
+            buffer,
+            sizeof(buffer),
+            "Frame Statistics:\n"
+            "Queue Submits: %llu\n"
+            "Semaphores Waited: %llu\n"
+            "Fences Waited: %llu\n"
+            "Pipeline Barriers: %llu\n"
+            "Primary Command Buffers: %llu\n"
+            "Secondary Command Buffers: %llu\n"
+            "Descriptor Sets Allocated: %llu\n"
+            "Descriptor Writes Flushed: %llu\n"
+            "Pipelines Bound: %llu\n"
+            "Draws: %llu\n"
+            "Dispatches: %llu\n"
+            "Finalizer Entries Executed: %llu\n"
+            "Staging Uploaded: %.1f MB",
+            (unsigned long long)QueueSubmits,
+            (unsigned long long)SemaphoresWaited,
+            (unsigned long long)FencesWaited,
+            (unsigned long long)PipelineBarriers,
+            (unsigned long long)PrimaryCommandBuffersAllocated,
+            (unsigned long long)SecondaryCommandBuffersAllocated,
+            (unsigned long long)DescriptorSetsAllocated,
+            (unsigned long long)DescriptorWritesFlushed,
+            (unsigned long long)PipelinesBound,
+            (unsigned long long)Draws,
+            (unsigned long long)Dispatches,
+            (unsigned long long)FinalizerEntriesExecuted,
+            (float)StagingBytesUploaded / 1e6
+        );
+
         return std::string(buffer);
     }
 
@@ -51,6 +124,9 @@ namespace Flourish
         FL_ASSERT(s_BackendType == BackendType::None, "Cannot initialize, context has already been initialized");
 
         s_ReversedZBuffer = initInfo.UseReversedZBuffer;
+        s_Headless = initInfo.Headless;
+        s_FineGrainedFrameDependencies = initInfo.FineGrainedFrameDependencies;
+        s_DedicatedSubmissionThread = initInfo.DedicatedSubmissionThread;
         s_FrameBufferCount = initInfo.FrameBufferCount;
         s_LastFrameIndex = s_FrameBufferCount - 1;
         if (s_FrameBufferCount > MaxFrameBufferCount)
@@ -90,6 +166,19 @@ namespace Flourish
 
         FL_ASSERT(s_BackendType != BackendType::None, "Cannot begin frame, context has not been initialized");
 
+        // The previous frame is handed to the submission thread, so it only ends once that thread is done with it
+        if (s_FrameSubmissionPending)
+        {
+            switch (s_BackendType)
+            {
+                default: return;
+                case BackendType::Vulkan: { Vulkan::Context::WaitOnFrameSubmissions(); } break;
+            }
+
+            s_FrameSubmissionPending = false;
+            AdvanceFrame();
+        }
+
         switch (s_BackendType)
         {
             default: return;
@@ -109,11 +198,13 @@ namespace Flourish
             case BackendType::Vulkan: { Vulkan::Context::EndFrame(); } break;
         }
 
-        s_GraphSubmissions.clear();
-        s_ContextSubmissions.clear();
-        s_FrameCount++;
-        s_LastFrameIndex = s_FrameIndex;
-        s_FrameIndex = (s_FrameIndex + 1) % FrameBufferCount();
+        if (s_DedicatedSubmissionThread)
+        {
+            s_FrameSubmissionPending = true;
+            return;
+        }
+
+        AdvanceFrame();
     }
     
     void Context::PushFrameRenderGraph(RenderGraph* graph)
@@ -174,4 +265,98 @@ namespace Flourish
             case BackendType::Vulkan: { return Vulkan::Context::ComputeMemoryStatistics(); }
         }
     }
+
+    std::vector<MemoryAllocationInfo> Context::GetLiveAllocations()
+    {
+        FL_PROFILE_FUNCTION();
+
+        switch (s_BackendType)
+        {
+            default: return {};
+            case BackendType::Vulkan: { return Vulkan::Context::MemoryTracker().GetLiveAllocations(); }
+        }
+    }
+
+    FrameStatistics Context::GetFrameStatistics()
+    {
+        std::lock_guard lock(s_FrameCounterMutex);
+        return s_FrameStatistics;
+    }
+
+    Context::FrameCounterBlock& Context::GetThreadFrameCounters()
+    {
+        // Each thread gets its own block so that incrementing is uncontended. Blocks are
+        // registered on first use and fold their remaining counts back in on thread exit
+        struct ThreadFrameCounters
+        {
+            ThreadFrameCounters()
+            {
+                for (auto& counter : Block)
+                    counter.store(0, std::memory_order_relaxed);
+
+                std::lock_guard lock(s_FrameCounterMutex);
+                s_FrameCounterBlocks.emplace_back(&Block);
+            }
+
+            ~ThreadFrameCounters()
+            {
+                std::lock_guard lock(s_FrameCounterMutex);
+                for (u32 i = 0; i < Block.size(); i++)
+                    s_RetiredFrameCounters[i] += Block[i].load(std::memory_order_relaxed);
+                s_FrameCounterBlocks.erase(
+                    std::find(s_FrameCounterBlocks.begin(), s_FrameCounterBlocks.end(), &Block)
+                );
+            }
+
+            FrameCounterBlock Block;
+        };
+
+        thread_local ThreadFrameCounters counters;
+        return counters.Block;
+    }
+
+    void Context::MergeFrameCounters()
+    {
+        FL_PROFILE_FUNCTION();
+
+        std::lock_guard lock(s_FrameCounterMutex);
+
+        auto totals = s_RetiredFrameCounters;
+        s_RetiredFrameCounters.fill(0);
+        for (auto block : s_FrameCounterBlocks)
+            for (u32 i = 0; i < totals.size(); i++)
+                totals[i] += (*block)[i].exchange(0, std::memory_order_relaxed);
+
+        const auto count = [&totals](FrameCounter counter) { return totals[static_cast<u32>(counter)]; };
+        s_FrameStatistics.QueueSubmits = count(FrameCounter::QueueSubmits);
+        s_FrameStatistics.SemaphoresWaited = count(FrameCounter::SemaphoresWaited);
+        s_FrameStatistics.FencesWaited = count(FrameCounter::FencesWaited);
+        s_FrameStatistics.PipelineBarriers = count(FrameCounter::PipelineBarriers);
+        s_FrameStatistics.PrimaryCommandBuffersAllocated = count(FrameCounter::PrimaryCommandBuffersAllocated);
+        s_FrameStatistics.SecondaryCommandBuffersAllocated = count(FrameCounter::SecondaryCommandBuffersAllocated);
+        s_FrameStatistics.DescriptorSetsAllocated = count(FrameCounter::DescriptorSetsAllocated);
+        s_FrameStatistics.DescriptorWritesFlushed = count(FrameCounter::DescriptorWritesFlushed);
+        s_FrameStatistics.PipelinesBound = count(FrameCounter::PipelinesBound);
+        s_FrameStatistics.Draws = count(FrameCounter::Draws);
+        s_FrameStatistics.Dispatches = count(FrameCounter::Dispatches);
+        s_FrameStatistics.FinalizerEntriesExecuted = count(FrameCounter::FinalizerEntriesExecuted);
+        s_FrameStatistics.StagingBytesUploaded = count(FrameCounter::StagingBytesUploaded);
+
+        FL_PROFILE_COUNTER("QueueSubmits", s_FrameStatistics.QueueSubmits);
+        FL_PROFILE_COUNTER("PipelineBarriers", s_FrameStatistics.PipelineBarriers);
+        FL_PROFILE_COUNTER("DescriptorWritesFlushed", s_FrameStatistics.DescriptorWritesFlushed);
+        FL_PROFILE_COUNTER("Draws", s_FrameStatistics.Draws);
+        FL_PROFILE_COUNTER("FinalizerEntriesExecuted", s_FrameStatistics.FinalizerEntriesExecuted);
+    }
+
+    void Context::AdvanceFrame()
+    {
+        MergeFrameCounters();
+
+        s_GraphSubmissions.clear();
+        s_ContextSubmissions.clear();
+        s_FrameCount++;
+        s_LastFrameIndex = s_FrameIndex;
+        s_FrameIndex = (s_FrameIndex + 1) % FrameBufferCount();
+    }
 }
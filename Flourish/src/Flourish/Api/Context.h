@@ -13,6 +13,40 @@ namespace Flourish
         Metal
     };
 
+    enum class MemoryCategory : u32
+    {
+        Buffer = 0,
+        Staging,
+        Texture,
+        RenderTarget,
+        MsaaRenderTarget,
+        AccelerationStructure,
+        ShaderBindingTable,
+        Transient,
+
+        Count
+    };
+
+    const char* MemoryCategoryToString(MemoryCategory category);
+
+    struct MemoryCategoryStatistics
+    {
+        u32 AllocationCount = 0;
+        u64 CurrentSize = 0;
+        u64 PeakSize = 0;
+
+        // Churn during the last completed frame
+        u32 FrameAllocations = 0;
+        u32 FrameFrees = 0;
+    };
+
+    struct MemoryAllocationInfo
+    {
+        MemoryCategory Category;
+        u64 Size;
+        std::string DebugName;
+    };
+
     struct MemoryStatistics
     {
         // Manually allocated objects (i.e. buffers, textures)
@@ -26,6 +60,48 @@ namespace Flourish
         // Total reported GPU memory
         u64 TotalAvailable;
 
+        // Allocations made by the library, indexed by MemoryCategory
+        std::array<MemoryCategoryStatistics, static_cast<u32>(MemoryCategory::Count)> Categories;
+
+        std::string ToString() const;
+    };
+
+    enum class FrameCounter : u32
+    {
+        QueueSubmits = 0,
+        SemaphoresWaited,
+        FencesWaited,
+        PipelineBarriers,
+        PrimaryCommandBuffersAllocated,
+        SecondaryCommandBuffersAllocated,
+        DescriptorSetsAllocated,
+        DescriptorWritesFlushed,
+        PipelinesBound,
+        Draws,
+        Dispatches,
+        FinalizerEntriesExecuted,
+        StagingBytesUploaded,
+
+        Count
+    };
+
+    // Counters are accumulated per thread and merged at the end of each frame
+    struct FrameStatistics
+    {
+        u64 QueueSubmits = 0;
+        u64 SemaphoresWaited = 0; // Semaphores waited on by queue submissions
+        u64 FencesWaited = 0; // Fences waited on by the host
+        u64 PipelineBarriers = 0;
+        u64 PrimaryCommandBuffersAllocated = 0;
+        u64 SecondaryCommandBuffersAllocated = 0;
+        u64 DescriptorSetsAllocated = 0;
+        u64 DescriptorWritesFlushed = 0;
+        u64 PipelinesBound = 0;
+        u64 Draws = 0;
+        u64 Dispatches = 0;
+        u64 FinalizerEntriesExecuted = 0;
+        u64 StagingBytesUploaded = 0;
+
         std::string ToString() const;
     };
 
@@ -40,6 +116,35 @@ namespace Flourish
         bool UseReversedZBuffer = true;
         FeatureTable RequestedFeatures;
 
+        // Skips all window surface and presentation requirements so that the context can
+        // run without a display (i.e. CI or software drivers). RenderContexts created while
+        // headless are always offscreen
+        bool Headless = false;
+
+        // Brackets every encoder submitted in a frame RenderGraph with GPU timestamps. Results
+        // are available through RenderGraph::GetEncoderTimestamp once FrameBufferCount frames
+        // have passed
+        bool AutomaticGraphTimestamps = false;
+
+        // By default every frame waits for the previous one to finish on the GPU. When enabled, frame
+        // RenderGraph submissions only wait on the earlier submissions that last accessed the resources
+        // they declare, so independent work can overlap the tail of the previous frame. Every resource
+        // shared across frames must then be declared, including textures read by RenderContexts through
+        // RenderContext::AddFrameRead. Graphs with transient resources always wait on the whole frame.
+        // Requires timeline semaphore support
+        bool FineGrainedFrameDependencies = false;
+
+        // Number of threads that record the primary command buffers of frame RenderGraphs in parallel
+        // alongside the thread calling EndFrame. Zero records everything on that thread
+        u32 SubmissionRecordingThreads = 0;
+
+        // Processes frame RenderGraphs and presents RenderContexts on a dedicated thread, so EndFrame returns as
+        // soon as the frame is handed off. The frame stays current until the next BeginFrame waits for that thread,
+        // which is also when the frame counters advance. Graphs and contexts pushed for the frame, and the
+        // resources and framebuffers they reference, must not be modified before then. Destroying a texture, buffer
+        // or framebuffer in the meantime blocks until the thread is done with the frame
+        bool DedicatedSubmissionThread = false;
+
         // Custom file read handler. Defaults to standard std::ifstream
         ReadFileFn ReadFile = nullptr;
     };
@@ -62,6 +167,15 @@ namespace Flourish
 
         // TS
         static MemoryStatistics ComputeMemoryStatistics();
+        static std::vector<MemoryAllocationInfo> GetLiveAllocations();
+
+        // TS
+        // Statistics from the most recently completed frame
+        static FrameStatistics GetFrameStatistics();
+        inline static void IncrementFrameCounter(FrameCounter counter, u64 amount = 1)
+        {
+            GetThreadFrameCounters()[static_cast<u32>(counter)].fetch_add(amount, std::memory_order_relaxed);
+        }
 
         // TS
         inline static BackendType BackendType() { return s_BackendType; }
@@ -70,6 +184,8 @@ namespace Flourish
         inline static u32 FrameIndex() { return s_FrameIndex; }
         inline static u32 LastFrameIndex() { return s_LastFrameIndex; }
         inline static bool ReversedZBuffer() { return s_ReversedZBuffer; }
+        inline static bool Headless() { return s_Headless; }
+        inline static bool FineGrainedFrameDependencies() { return s_FineGrainedFrameDependencies; }
         inline static FeatureTable& FeatureTable() { return s_FeatureTable; }
         inline static const auto& ReadFile() { return s_ReadFile; }
         inline static const auto& FrameGraphSubmissions() { return s_GraphSubmissions; }
@@ -78,9 +194,20 @@ namespace Flourish
 
         inline static constexpr u32 MaxFrameBufferCount = 3;
         
+    private:
+        using FrameCounterBlock = std::array<std::atomic<u64>, static_cast<u32>(FrameCounter::Count)>;
+
+        static FrameCounterBlock& GetThreadFrameCounters();
+        static void MergeFrameCounters();
+        static void AdvanceFrame();
+
     private:
         inline static Flourish::BackendType s_BackendType = BackendType::None;
         inline static bool s_ReversedZBuffer = true;
+        inline static bool s_Headless = false;
+        inline static bool s_FineGrainedFrameDependencies = false;
+        inline static bool s_DedicatedSubmissionThread = false;
+        inline static bool s_FrameSubmissionPending = false;
         inline static u32 s_FrameBufferCount = 0;
         inline static u64 s_FrameCount = 1;
         inline static u32 s_FrameIndex = 0;
@@ -91,5 +218,9 @@ namespace Flourish
         inline static std::mutex s_FrameMutex;
         inline static std::atomic<u64> s_IdCounter = { 1 };
         inline static ReadFileFn s_ReadFile;
+        inline static std::vector<FrameCounterBlock*> s_FrameCounterBlocks;
+        inline static std::array<u64, static_cast<u32>(FrameCounter::Count)> s_RetiredFrameCounters = {};
+        inline static FrameStatistics s_FrameStatistics;
+        inline static std::mutex s_FrameCounterMutex;
     };
 }
@@ -2,10 +2,17 @@
 #include "RenderContext.h"
 
 #include "Flourish/Api/Context.h"
+#include "Flourish/Api/Texture.h"
 #include "Flourish/Backends/Vulkan/RenderContext.h"
 
 namespace Flourish
 {
+    void RenderContext::AddFrameRead(const Texture* texture)
+    {
+        if (std::find(m_FrameReads.begin(), m_FrameReads.end(), texture->GetId()) == m_FrameReads.end())
+            m_FrameReads.emplace_back(texture->GetId());
+    }
+
     std::shared_ptr<RenderContext> RenderContext::Create(const RenderContextCreateInfo& createInfo)
     {
         FL_ASSERT(Context::BackendType() != BackendType::None, "Must initialize Context before creating a RenderContext");
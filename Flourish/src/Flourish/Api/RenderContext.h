@@ -24,15 +24,21 @@ namespace Flourish
         u32 Width;
         u32 Height;
         std::array<float, 4> ClearColor = { 0.f, 0.f, 0.f, 0.f };
+
+        // Render into a ring of plain images instead of a window swapchain. Window
+        // parameters are ignored. Always enabled when the context is headless
+        bool Offscreen = false;
     };
 
     class RenderCommandEncoder;
     class Framebuffer;
+    class Texture;
     class RenderPass;
     class RenderContext
     {
     public:
         RenderContext(const RenderContextCreateInfo& createInfo)
+            : m_Offscreen(createInfo.Offscreen || Context::Headless())
         {}
         virtual ~RenderContext() = default;
 
@@ -40,11 +46,28 @@ namespace Flourish
         virtual RenderPass* GetRenderPass() const = 0;
         virtual bool Validate() = 0;
 
+        // Texture backing the image that was most recently encoded. Offscreen images are left
+        // in a readable state, so this can be used to copy out the result of a frame
+        virtual Texture* GetActiveTexture() const = 0;
+
         // Can only encode once per frame
         [[nodiscard]] virtual RenderCommandEncoder* EncodeRenderCommands() = 0;
 
+        // Declares a texture read by the commands encoded this frame. Only needed with fine grained frame
+        // dependencies, where the next writes to the texture wait on this context instead of the whole frame
+        void AddFrameRead(const Texture* texture);
+
+        // TS
+        inline bool IsOffscreen() const { return m_Offscreen; }
+        inline const auto& GetFrameReads() const { return m_FrameReads; }
+        inline void ClearFrameReads() { m_FrameReads.clear(); }
+
     public:
         // TS
         static std::shared_ptr<RenderContext> Create(const RenderContextCreateInfo& createInfo);
+
+    protected:
+        bool m_Offscreen;
+        std::vector<u64> m_FrameReads; // Texture ids
     };
 }
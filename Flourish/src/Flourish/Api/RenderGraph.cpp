@@ -6,6 +6,44 @@
 
 namespace Flourish
 {
+    // Splitmix64 finalizer
+    static u64 MixHash(u64 value)
+    {
+        value += 0x9e3779b97f4a7c15;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+
+    static u64 CombineHash(u64 seed, u64 value)
+    {
+        return MixHash(seed ^ MixHash(value));
+    }
+
+    static u64 HashNode(u64 id, const RenderGraphNode& node)
+    {
+        u64 hash = CombineHash(MixHash(id), node.HasSideEffects);
+        for (u64 depId : node.ExecutionDependencies)
+            hash = CombineHash(hash, depId);
+        for (auto& encoder : node.EncoderNodes)
+        {
+            hash = CombineHash(hash, static_cast<u64>(encoder.WorkloadType));
+
+            // Usages are summed so that the result does not depend on declaration order
+            u64 usageHash = encoder.UsageCount;
+            for (u32 i = 0; i < encoder.UsageCount; i++)
+            {
+                auto& usage = node.ResourceUsages[encoder.UsageOffset + i];
+                u64 accessBits = usage.Access |
+                    (static_cast<u64>(usage.AccessType) << 8) |
+                    (static_cast<u64>(usage.Stages) << 16);
+                usageHash += CombineHash(usage.ResourceId, accessBits);
+            }
+            hash = CombineHash(hash, usageHash);
+        }
+        return hash;
+    }
+
     RenderGraphNodeBuilder::RenderGraphNodeBuilder()
     {}
 
@@ -17,7 +55,13 @@ namespace Flourish
 
     RenderGraphNodeBuilder& RenderGraphNodeBuilder::Reset()
     {
-        m_Node = RenderGraphNode();
+        // Keep the capacity around so that reusing a builder does not allocate
+        m_Node.Buffer = nullptr;
+        m_Node.EstimatedCost = 0;
+        m_Node.HasSideEffects = true;
+        m_Node.ExecutionDependencies.clear();
+        m_Node.EncoderNodes.clear();
+        m_Node.ResourceUsages.clear();
         return *this;
     }
 
@@ -29,42 +73,91 @@ namespace Flourish
 
     RenderGraphNodeBuilder& RenderGraphNodeBuilder::AddExecutionDependency(const CommandBuffer* buffer)
     {
-        m_Node.ExecutionDependencies.insert(buffer->GetId());
+        auto& deps = m_Node.ExecutionDependencies;
+        u64 id = buffer->GetId();
+        auto pos = std::lower_bound(deps.begin(), deps.end(), id);
+        if (pos == deps.end() || *pos != id)
+            deps.insert(pos, id);
+        return *this;
+    }
+
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::SetEstimatedCost(d64 nanoseconds)
+    {
+        m_Node.EstimatedCost = nanoseconds;
+        return *this;
+    }
+
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::SetHasSideEffects(bool hasSideEffects)
+    {
+        m_Node.HasSideEffects = hasSideEffects;
         return *this;
     }
 
     RenderGraphNodeBuilder& RenderGraphNodeBuilder::AddEncoderNode(GPUWorkloadType workloadType)
     {
-        m_Node.EncoderNodes.emplace_back();
-        m_Node.EncoderNodes.back().WorkloadType = workloadType;
+        auto& encoder = m_Node.EncoderNodes.emplace_back();
+        encoder.WorkloadType = workloadType;
+        encoder.UsageOffset = static_cast<u32>(m_Node.ResourceUsages.size());
         return *this;
     }
 
-    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddBufferRead(const Buffer* buffer)
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddBufferRead(const Buffer* buffer, RenderGraphResourceAccessType type, ShaderType stages)
     {
-        FL_ASSERT(!m_Node.EncoderNodes.empty(), "Must call AddEncoderNode first");
-        m_Node.EncoderNodes.back().ReadResources.insert(buffer->GetId());
+        EncoderAddUsage({
+            buffer->GetId(), buffer, RenderGraphResourceType::Buffer,
+            RenderGraphResourceAccessFlags::Read, type, stages
+        });
         return *this;
     }
 
-    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddBufferWrite(const Buffer* buffer)
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddBufferWrite(const Buffer* buffer, RenderGraphResourceAccessType type, ShaderType stages)
     {
-        m_Node.EncoderNodes.back().WriteResources.insert(buffer->GetId());
+        EncoderAddUsage({
+            buffer->GetId(), buffer, RenderGraphResourceType::Buffer,
+            RenderGraphResourceAccessFlags::Write, type, stages
+        });
         return *this;
     }
 
-    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddTextureRead(const Texture* texture)
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddTextureRead(const Texture* texture, RenderGraphResourceAccessType type, ShaderType stages)
     {
-        m_Node.EncoderNodes.back().ReadResources.insert(texture->GetId());
+        EncoderAddUsage({
+            texture->GetId(), texture, RenderGraphResourceType::Texture,
+            RenderGraphResourceAccessFlags::Read, type, stages
+        });
         return *this;
     }
 
-    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddTextureWrite(const Texture* texture)
+    RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddTextureWrite(const Texture* texture, RenderGraphResourceAccessType type, ShaderType stages)
     {
-        m_Node.EncoderNodes.back().WriteResources.insert(texture->GetId());
+        EncoderAddUsage({
+            texture->GetId(), texture, RenderGraphResourceType::Texture,
+            RenderGraphResourceAccessFlags::Write, type, stages
+        });
         return *this;
     }
 
+    void RenderGraphNodeBuilder::EncoderAddUsage(const RenderGraphResourceUsage& usage)
+    {
+        FL_ASSERT(!m_Node.EncoderNodes.empty(), "Must call AddEncoderNode first");
+
+        // Encoders only reference a handful of resources, so a linear scan beats any lookup structure
+        auto& encoder = m_Node.EncoderNodes.back();
+        for (u32 i = encoder.UsageOffset; i < m_Node.ResourceUsages.size(); i++)
+        {
+            auto& existing = m_Node.ResourceUsages[i];
+            if (existing.ResourceId == usage.ResourceId && existing.AccessType == usage.AccessType)
+            {
+                existing.Access |= usage.Access;
+                existing.Stages |= usage.Stages;
+                return;
+            }
+        }
+
+        m_Node.ResourceUsages.push_back(usage);
+        encoder.UsageCount++;
+    }
+
     RenderGraphNodeBuilder& RenderGraphNodeBuilder::EncoderAddFramebuffer(const Framebuffer* framebuffer)
     {
         RenderPass* pass = framebuffer->GetRenderPass();
@@ -75,8 +168,8 @@ namespace Flourish
             if (!tex)
                 continue;
             if (pass->GetColorAttachment(i).Initialization == Flourish::AttachmentInitialization::Preserve)
-                EncoderAddTextureRead(tex.get());
-            EncoderAddTextureWrite(tex.get());
+                EncoderAddTextureRead(tex.get(), RenderGraphResourceAccessType::ColorAttachment);
+            EncoderAddTextureWrite(tex.get(), RenderGraphResourceAccessType::ColorAttachment);
         }
 
         for (u32 i = 0; i < framebuffer->GetDepthAttachments().size(); i++)
@@ -85,8 +178,8 @@ namespace Flourish
             if (!tex)
                 continue;
             if (pass->GetDepthAttachment(i).Initialization == Flourish::AttachmentInitialization::Preserve)
-                EncoderAddTextureRead(tex.get());
-            EncoderAddTextureWrite(tex.get());
+                EncoderAddTextureRead(tex.get(), RenderGraphResourceAccessType::DepthAttachment);
+            EncoderAddTextureWrite(tex.get(), RenderGraphResourceAccessType::DepthAttachment);
         }
 
         return *this;
@@ -121,30 +214,69 @@ namespace Flourish
             return;
         }
 
-        auto found = m_Nodes.find(buffer->GetId());
-        if (found == m_Nodes.end())
+        const RenderGraphNodeData* node = FindNode(buffer->GetId());
+        if (!node)
         {
             FL_LOG_WARN("AddExecutionDependency buffer is not in graph");
             return;
         }
 
-        if (m_Nodes.find(dependsOn->GetId()) == m_Nodes.end())
+        if (!FindNode(dependsOn->GetId()))
         {
             FL_LOG_WARN("AddExecutionDependency dependsOn is not in graph");
             return;
         }
 
-        m_Leaves.erase(dependsOn->GetId());
-        found->second.ExecutionDependencies.insert(dependsOn->GetId());
+        // Skip dependencies that already exist so that they do not change the topology hash
+        auto depsBegin = m_Dependencies.begin() + node->DependencyOffset;
+        auto depsEnd = depsBegin + node->DependencyCount;
+        std::pair<u64, u64> late = { buffer->GetId(), dependsOn->GetId() };
+        u64 lateHash = CombineHash(late.first, late.second);
+        if (std::binary_search(depsBegin, depsEnd, late.second))
+            return;
+        u32 existing = m_LateDependencyIndices.Find(lateHash, [this, &late](u32 index) { return m_LateDependencies[index] == late; });
+        if (existing != RenderGraphIndexTable::InvalidIndex)
+            return;
+
+        m_LateDependencyIndices.Insert(lateHash, static_cast<u32>(m_LateDependencies.size()));
+        m_LateDependencies.emplace_back(late);
+        m_TopologyHash = CombineHash(m_TopologyHash, lateHash);
     }
 
     void RenderGraph::Clear()
     {
-        m_Leaves.clear();
         m_Nodes.clear();
+        m_Dependencies.clear();
+        m_LateDependencies.clear();
+        m_Encoders.clear();
+        m_ResourceUsages.clear();
+        m_NodeIndices.Clear();
+        m_LateDependencyIndices.Clear();
+        m_TopologyHash = 0;
         m_Built = false;
     }
 
+    const RenderGraphNodeData* RenderGraph::FindNode(u64 id) const
+    {
+        u32 index = FindNodeIndex(id);
+        if (index == RenderGraphIndexTable::InvalidIndex)
+            return nullptr;
+        return &m_Nodes[index];
+    }
+
+    u32 RenderGraph::FindNodeIndex(u64 id) const
+    {
+        return m_NodeIndices.Find(MixHash(id), [this, id](u32 index) { return m_Nodes[index].Id == id; });
+    }
+
+    RenderGraphTimestamp RenderGraph::GetEncoderTimestamp(u64 nodeId, u32 encoderIndex) const
+    {
+        auto found = m_Timestamps.find(nodeId);
+        if (found == m_Timestamps.end() || encoderIndex >= found->second.size())
+            return RenderGraphTimestamp();
+        return found->second[encoderIndex];
+    }
+
     void RenderGraph::AddInternal(const RenderGraphNode& addData)
     {
         if (!addData.Buffer)
@@ -153,25 +285,68 @@ namespace Flourish
             return;
         }
         u64 id = addData.Buffer->GetId();
-        auto found = m_Nodes.find(id);
-        if (found == m_Nodes.end())
-        {
-            m_Nodes.insert({ id, addData });
-            m_Leaves.insert(id);
-        }
-        else
+        if (FindNodeIndex(id) != RenderGraphIndexTable::InvalidIndex)
         {
             FL_LOG_WARN("Adding a node to rendergraph that was already added");
             return;
         }
+        m_NodeIndices.Insert(MixHash(id), static_cast<u32>(m_Nodes.size()));
+
+        auto& node = m_Nodes.emplace_back();
+        node.Id = id;
+        node.Buffer = addData.Buffer;
+        node.DependencyOffset = static_cast<u32>(m_Dependencies.size());
+        node.DependencyCount = static_cast<u32>(addData.ExecutionDependencies.size());
+        node.EncoderOffset = static_cast<u32>(m_Encoders.size());
+        node.EncoderCount = static_cast<u32>(addData.EncoderNodes.size());
+        node.EstimatedCost = addData.EstimatedCost;
+        node.HasSideEffects = addData.HasSideEffects;
+        node.Culled = false;
 
-        for (u64 parentId : addData.ExecutionDependencies)
+        // Dependencies may reference nodes that are added later, so they stay as ids until build
+        m_Dependencies.insert(m_Dependencies.end(), addData.ExecutionDependencies.begin(), addData.ExecutionDependencies.end());
+
+        u32 usageBase = static_cast<u32>(m_ResourceUsages.size());
+        for (auto& encoder : addData.EncoderNodes)
         {
-            if (parentId == 0 || m_Nodes.find(parentId) == m_Nodes.end())
-                return;
+            auto& added = m_Encoders.emplace_back(encoder);
+            added.UsageOffset += usageBase;
+        }
+        m_ResourceUsages.insert(m_ResourceUsages.end(), addData.ResourceUsages.begin(), addData.ResourceUsages.end());
+
+        m_TopologyHash = CombineHash(m_TopologyHash, HashNode(id, addData));
+    }
 
-            m_Leaves.erase(parentId);
+    void RenderGraphIndexTable::Clear()
+    {
+        if (m_Count == 0)
+            return;
+
+        for (auto& slot : m_Slots)
+            slot.Index = InvalidIndex;
+        m_Count = 0;
+    }
+
+    void RenderGraphIndexTable::Insert(u64 hash, u32 index)
+    {
+        if ((m_Count + 1) * 2 > m_Slots.size())
+        {
+            std::vector<Slot> oldSlots;
+            oldSlots.swap(m_Slots);
+            m_Slots.resize(std::max<size_t>(64, oldSlots.size() * 2));
+            m_Count = 0;
+            for (auto& slot : oldSlots)
+                if (slot.Index != InvalidIndex)
+                    Insert(slot.Hash, slot.Index);
         }
+
+        u32 mask = static_cast<u32>(m_Slots.size()) - 1;
+        u32 i = static_cast<u32>(hash) & mask;
+        while (m_Slots[i].Index != InvalidIndex)
+            i = (i + 1) & mask;
+        m_Slots[i].Hash = hash;
+        m_Slots[i].Index = index;
+        m_Count++;
     }
 
     std::shared_ptr<RenderGraph> RenderGraph::Create(const RenderGraphCreateInfo& createInfo)
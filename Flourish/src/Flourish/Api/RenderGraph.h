@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Flourish/Api/CommandBuffer.h"
+#include "Flourish/Api/Shader.h"
+#include "Flourish/Api/Texture.h"
 
 namespace Flourish
 {
@@ -11,27 +13,149 @@ namespace Flourish
         BuildPerFrame // Build and use every frame
     };
 
+    enum class RenderGraphExportFormat
+    {
+        Dot = 0,
+        Json
+    };
+
     struct RenderGraphCreateInfo
     {
         RenderGraphUsageType Usage = RenderGraphUsageType::PerFrame;
     };
 
+    namespace RenderGraphResourceAccessEnum
+    {
+        enum Value : u8
+        {
+            None = 0,
+            Read = (1 << 0),
+            Write = (1 << 1)
+        };
+    }
+    typedef RenderGraphResourceAccessEnum::Value RenderGraphResourceAccessFlags;
+    typedef u8 RenderGraphResourceAccess;
+
+    // How an encoder consumes a resource, which determines the pipeline stages and access masks used
+    // when synchronizing it. Generic resources are synchronized conservatively over the whole workload
+    enum class RenderGraphResourceAccessType : u8
+    {
+        Generic = 0,
+        Sampled,
+        Uniform,
+        Storage,
+        ColorAttachment,
+        DepthAttachment,
+        VertexBuffer,
+        IndexBuffer,
+        Indirect,
+        Transfer
+    };
+
+    enum class RenderGraphResourceType : u8
+    {
+        Buffer = 0,
+        Texture
+    };
+
+    // Each resource appears at most once per encoder and access type with its accesses combined
+    struct RenderGraphResourceUsage
+    {
+        u64 ResourceId;
+        const void* Resource = nullptr; // Buffer or Texture depending on ResourceType
+        RenderGraphResourceType ResourceType = RenderGraphResourceType::Buffer;
+        RenderGraphResourceAccess Access = RenderGraphResourceAccessFlags::None;
+        RenderGraphResourceAccessType AccessType = RenderGraphResourceAccessType::Generic;
+
+        // Shader stages that consume the resource for Sampled, Uniform and Storage accesses
+        ShaderType Stages = ShaderTypeFlags::All;
+    };
+
     struct RenderGraphEncoderNode
     {
         GPUWorkloadType WorkloadType;
-        std::unordered_set<u64> ReadResources;
-        std::unordered_set<u64> WriteResources;
+
+        // Range into the resource usages of the owning node, or of the graph once added
+        u32 UsageOffset = 0;
+        u32 UsageCount = 0;
+    };
+
+    // Nanoseconds on the GPU timeline
+    struct RenderGraphTimestamp
+    {
+        d64 Start = 0;
+        d64 End = 0;
     };
 
+    // Node declaration as built by RenderGraphNodeBuilder. Dependencies are kept sorted
     struct RenderGraphNode
     {
         CommandBuffer* Buffer = nullptr;
-        std::unordered_set<u64> ExecutionDependencies;
+        d64 EstimatedCost = 0;
+        bool HasSideEffects = true;
+        std::vector<u64> ExecutionDependencies;
         std::vector<RenderGraphEncoderNode> EncoderNodes;
+        std::vector<RenderGraphResourceUsage> ResourceUsages;
+    };
+
+    // Node as stored inside a graph. Ranges index into the graph's flat arrays
+    struct RenderGraphNodeData
+    {
+        u64 Id;
+        CommandBuffer* Buffer;
+        u32 DependencyOffset;
+        u32 DependencyCount;
+        u32 EncoderOffset;
+        u32 EncoderCount;
+        d64 EstimatedCost;
+        bool HasSideEffects;
+
+        // Set by Build when nothing that executes depends on the node. Culled nodes are skipped on
+        // submission, so their command buffers do not need to be encoded
+        bool Culled;
+    };
+
+    // Open addressed table of indices into one of the graph's arrays, keyed by a hash of the entry. Callers
+    // compare the entries themselves, so hash collisions are harmless. Clearing keeps the slots so that
+    // rebuilding a graph every frame does not allocate once the table has grown
+    class RenderGraphIndexTable
+    {
+    public:
+        void Clear();
+        void Insert(u64 hash, u32 index);
+
+        template <typename Equals>
+        u32 Find(u64 hash, Equals&& equals) const
+        {
+            if (m_Slots.empty())
+                return InvalidIndex;
+
+            u32 mask = static_cast<u32>(m_Slots.size()) - 1;
+            for (u32 i = static_cast<u32>(hash) & mask;; i = (i + 1) & mask)
+            {
+                auto& slot = m_Slots[i];
+                if (slot.Index == InvalidIndex)
+                    return InvalidIndex;
+                if (slot.Hash == hash && equals(slot.Index))
+                    return slot.Index;
+            }
+        }
+
+    public:
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+    private:
+        struct Slot
+        {
+            u64 Hash = 0;
+            u32 Index = InvalidIndex;
+        };
+
+    private:
+        std::vector<Slot> m_Slots; // Power of two sized, at most half full
+        u32 m_Count = 0;
     };
 
-    class Buffer;
-    class Texture;
     class RenderGraph;
     class Framebuffer;
     class RenderGraphNodeBuilder
@@ -44,14 +168,47 @@ namespace Flourish
         RenderGraphNodeBuilder& SetCommandBuffer(CommandBuffer* buffer);
         RenderGraphNodeBuilder& AddExecutionDependency(const CommandBuffer* buffer);
 
+        // Expected GPU time of the node in nanoseconds, used to schedule the graph when no measured
+        // timestamps are available. Does not affect the topology hash
+        RenderGraphNodeBuilder& SetEstimatedCost(d64 nanoseconds);
+
+        // Nodes are assumed to have effects outside of the graph, such as writing to a swapchain, a readback
+        // buffer or a resource that persists across frames. Nodes without them are culled during Build
+        // when no surviving node reads what they write or depends on them
+        RenderGraphNodeBuilder& SetHasSideEffects(bool hasSideEffects);
+
         RenderGraphNodeBuilder& AddEncoderNode(GPUWorkloadType workloadType);
-        RenderGraphNodeBuilder& EncoderAddBufferRead(const Buffer* buffer);
-        RenderGraphNodeBuilder& EncoderAddBufferWrite(const Buffer* buffer);
-        RenderGraphNodeBuilder& EncoderAddTextureRead(const Texture* texture);
-        RenderGraphNodeBuilder& EncoderAddTextureWrite(const Texture* texture);
+
+        // Declaring the access type and consuming shader stages allows the graph to emit narrow
+        // per-resource barriers rather than a memory barrier over the whole workload
+        RenderGraphNodeBuilder& EncoderAddBufferRead(
+            const Buffer* buffer,
+            RenderGraphResourceAccessType type = RenderGraphResourceAccessType::Generic,
+            ShaderType stages = ShaderTypeFlags::All
+        );
+        RenderGraphNodeBuilder& EncoderAddBufferWrite(
+            const Buffer* buffer,
+            RenderGraphResourceAccessType type = RenderGraphResourceAccessType::Generic,
+            ShaderType stages = ShaderTypeFlags::All
+        );
+        RenderGraphNodeBuilder& EncoderAddTextureRead(
+            const Texture* texture,
+            RenderGraphResourceAccessType type = RenderGraphResourceAccessType::Generic,
+            ShaderType stages = ShaderTypeFlags::All
+        );
+        RenderGraphNodeBuilder& EncoderAddTextureWrite(
+            const Texture* texture,
+            RenderGraphResourceAccessType type = RenderGraphResourceAccessType::Generic,
+            ShaderType stages = ShaderTypeFlags::All
+        );
 
         RenderGraphNodeBuilder& EncoderAddFramebuffer(const Framebuffer* framebuffer);
 
+    private:
+        void EncoderAddUsage(const RenderGraphResourceUsage& usage);
+
+    public:
+
         void AddToGraph() const;
         void AddToGraph(RenderGraph* graph) const;
 
@@ -74,26 +231,71 @@ namespace Flourish
         RenderGraphNodeBuilder ConstructNewNode(CommandBuffer* buffer);
         void AddExecutionDependency(const CommandBuffer* buffer, const CommandBuffer* dependsOn);
 
+        // Graphs whose topology does not change are rescheduled when measured GPU times first become
+        // available and whenever they drift. Graphs without transient resources are rescheduled as they
+        // are submitted, others by their next Build
         virtual void Build() = 0;
 
+        // Transient resources are owned by the graph and only hold their contents between their first
+        // and last use within one execution. Build places transients whose lifetimes do not overlap in
+        // shared memory and synchronizes the reuse, so they have no memory until the graph is built.
+        // Their handles change when a build moves them, so resource sets and framebuffers that
+        // reference them must be updated after Build
+        virtual std::shared_ptr<Texture> CreateTransientTexture(const TextureCreateInfo& createInfo) = 0;
+        virtual std::shared_ptr<Buffer> CreateTransientBuffer(const BufferCreateInfo& createInfo) = 0;
+
+        // Describes the last build: nodes, their encoders, the queues and submissions they run in, the
+        // submissions each one waits on and the barriers recorded before each encoder. Timings annotate
+        // nodes with their last measured GPU time and the CPU time spent recording them for submission,
+        // both of which require automatic graph timestamps
+        virtual std::string Export(RenderGraphExportFormat format, bool includeTimings = true) const = 0;
+
         // TS
         inline bool IsBuilt() const { return m_Built; }
-        inline const RenderGraphNode& GetNode(u64 id) const { return m_Nodes.at(id); }
-        inline const auto& GetNodes() const { return m_Nodes; }
-        inline const auto& GetLeaves() const { return m_Leaves; }
+        inline u32 GetNodeCount() const { return static_cast<u32>(m_Nodes.size()); }
+        inline const RenderGraphNodeData& GetNode(u32 index) const { return m_Nodes[index]; }
+        inline const RenderGraphEncoderNode& GetEncoder(const RenderGraphNodeData& node, u32 encoderIndex) const { return m_Encoders[node.EncoderOffset + encoderIndex]; }
+        inline const RenderGraphResourceUsage& GetResourceUsage(const RenderGraphEncoderNode& encoder, u32 usageIndex) const { return m_ResourceUsages[encoder.UsageOffset + usageIndex]; }
+        const RenderGraphNodeData* FindNode(u64 id) const;
         inline RenderGraphUsageType GetUsage() const { return m_Info.Usage; }
 
+        // Hash of every node, encoder, resource and dependency declared since the last Clear. Builds
+        // that see the same hash as the previous build reuse its results
+        inline u64 GetTopologyHash() const { return m_TopologyHash; }
+
+        // Populated when automatic graph timestamps are enabled. Values lag FrameBufferCount frames
+        // behind and are zero for transfer encoders
+        RenderGraphTimestamp GetEncoderTimestamp(u64 nodeId, u32 encoderIndex) const;
+        inline const auto& GetTimestamps() const { return m_Timestamps; }
+        inline u64 GetTimestampFrame() const { return m_TimestampFrame; }
+
     public:
         static std::shared_ptr<RenderGraph> Create(const RenderGraphCreateInfo& createInfo);
 
     private:
         void AddInternal(const RenderGraphNode& addData);
 
+    protected:
+        // Returns RenderGraphIndexTable::InvalidIndex when no node has the id
+        u32 FindNodeIndex(u64 id) const;
+
     protected:
         RenderGraphCreateInfo m_Info;
-        std::unordered_set<u64> m_Leaves;
-        std::unordered_map<u64, RenderGraphNode> m_Nodes;
+
+        // Flat node storage whose capacity is kept across Clear so that rebuilding a graph every
+        // frame does not allocate. Dependencies added after a node are kept separately as
+        // (node, dependency) id pairs since they cannot extend the node's range
+        std::vector<RenderGraphNodeData> m_Nodes;
+        std::vector<u64> m_Dependencies;
+        std::vector<std::pair<u64, u64>> m_LateDependencies;
+        std::vector<RenderGraphEncoderNode> m_Encoders;
+        std::vector<RenderGraphResourceUsage> m_ResourceUsages;
+        RenderGraphIndexTable m_NodeIndices; // Keyed by node id
+        RenderGraphIndexTable m_LateDependencyIndices; // Keyed by (node, dependency) id pair
+        u64 m_TopologyHash = 0;
         bool m_Built = false;
+        std::unordered_map<u64, std::vector<RenderGraphTimestamp>> m_Timestamps;
+        u64 m_TimestampFrame = 0;
 
         friend class RenderGraphNodeBuilder;
     };
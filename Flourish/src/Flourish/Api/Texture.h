@@ -92,6 +92,9 @@ namespace Flourish
         u32 InitialDataSize = 0;
         bool AsyncCreation = false;
         std::function<void()> CreationCallback = nullptr;
+
+        // Used for memory accounting
+        std::string DebugName;
     };
 
     class Texture
@@ -14,21 +14,7 @@ namespace Flourish::Vulkan
             FL_LOG_WARN("Buffer has explicit stride %d that is not four byte aligned", m_Info.Stride);
         #endif
 
-        VkBufferUsageFlags usage = Common::ConvertBufferUsage(m_Info.Usage);
-
-        // TODO: this probably isn't great but we have no good way of specifying this in the api
-        usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-
-        if (m_Info.Usage & BufferUsageFlags::AccelerationStructureBuild)
-        {
-            FL_ASSERT(
-                Flourish::Context::FeatureTable().RayTracing,
-                "RayTracing feature must be enabled to create a buffer with acceleration structure build support"
-            );
-
-            // Force expose GPU address
-            m_Info.ExposeGPUAddress = true;
-        }
+        VkBufferUsageFlags usage = PopulateUsageFlags();
 
         VkCommandBuffer uploadBuffer = nullptr;
         if (m_Info.UploadEncoder)
@@ -55,15 +41,52 @@ namespace Flourish::Vulkan
         CreateInternal(usageFlags, uploadBuffer);
     }
 
+    Buffer::Buffer(const BufferCreateInfo& createInfo, VkMemoryRequirements& outRequirements)
+        : Flourish::Buffer(createInfo)
+    {
+        if (m_Info.MemoryType != BufferMemoryType::GPUOnly || m_Info.InitialData || m_Info.UploadEncoder)
+        {
+            FL_LOG_ERROR("Transient buffers must be GPUOnly and cannot be created with initial data");
+            throw std::exception();
+        }
+        if (GetAllocatedSize() == 0)
+        {
+            FL_LOG_ERROR("Cannot create a buffer with zero size");
+            throw std::exception();
+        }
+
+        m_IsTransient = true;
+        m_TransientCreateInfo = PopulateCreateInfo(PopulateUsageFlags());
+
+        BufferData& data = m_BufferAllocations.emplace_back();
+        if (!FL_VK_CHECK_RESULT(vkCreateBuffer(
+            Context::Devices().Device(),
+            &m_TransientCreateInfo,
+            nullptr,
+            &data.Buffer
+        ), "Buffer create transient buffer"))
+            throw std::exception();
+
+        vkGetBufferMemoryRequirements(Context::Devices().Device(), data.Buffer, &outRequirements);
+
+        m_WriteBuffers[0] = 0;
+        m_FlushBuffers[0] = 0;
+    }
+
     Buffer::~Buffer()
     {
-        auto buffers = m_BufferAllocations;
-        Context::FinalizerQueue().Push([=]()
+        // The submission thread may still be recording the frame that referenced this
+        Context::SubmissionHandler().WaitOnSubmissionThread();
+
+        if (m_IsTransient)
         {
-            for (u32 i = 0; i < buffers.size(); i++)
-                if (buffers[i].Buffer)
-                    vmaDestroyBuffer(Context::Allocator(), buffers[i].Buffer, buffers[i].Allocation);
-        }, "Buffer free");
+            // Transient memory belongs to the graph that placed the buffer
+            Context::FinalizerQueue().PushBuffer(m_BufferAllocations[0].Buffer);
+            return;
+        }
+
+        for (auto& data : m_BufferAllocations)
+            Context::FinalizerQueue().PushBuffer(data.Buffer, data.Allocation);
     }
 
     void Buffer::CreateInternal(VkBufferUsageFlags usage, VkCommandBuffer uploadBuffer)
@@ -74,12 +97,35 @@ namespace Flourish::Vulkan
             throw std::exception();
         }
 
-        auto device = Context::Devices().Device();
-        VkDeviceSize bufSize = static_cast<u64>(GetAllocatedSize());
+        CreateBuffers(PopulateCreateInfo(usage), uploadBuffer);
+    }
 
+    VkBufferUsageFlags Buffer::PopulateUsageFlags()
+    {
+        VkBufferUsageFlags usage = Common::ConvertBufferUsage(m_Info.Usage);
+
+        // TODO: this probably isn't great but we have no good way of specifying this in the api
+        usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+        if (m_Info.Usage & BufferUsageFlags::AccelerationStructureBuild)
+        {
+            FL_ASSERT(
+                Flourish::Context::FeatureTable().RayTracing,
+                "RayTracing feature must be enabled to create a buffer with acceleration structure build support"
+            );
+
+            // Force expose GPU address
+            m_Info.ExposeGPUAddress = true;
+        }
+
+        return usage;
+    }
+
+    VkBufferCreateInfo Buffer::PopulateCreateInfo(VkBufferUsageFlags usage)
+    {
         VkBufferCreateInfo bufCreateInfo{};
         bufCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufCreateInfo.size = bufSize;
+        bufCreateInfo.size = static_cast<u64>(GetAllocatedSize());
         bufCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         bufCreateInfo.usage = usage;
 
@@ -92,7 +138,46 @@ namespace Flourish::Vulkan
             bufCreateInfo.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
         }
 
-        CreateBuffers(bufCreateInfo, uploadBuffer);
+        return bufCreateInfo;
+    }
+
+    void Buffer::BindTransientMemory(VmaAllocation allocation, VkDeviceSize offset)
+    {
+        FL_ASSERT(m_IsTransient, "Cannot bind memory to a buffer that is not transient");
+
+        // Buffers can only be bound once, so moving to a new placement requires a new buffer
+        BufferData& data = m_BufferAllocations[0];
+        if (data.Allocation)
+        {
+            Context::FinalizerQueue().PushBuffer(data.Buffer);
+
+            data = BufferData();
+            if (!FL_VK_CHECK_RESULT(vkCreateBuffer(
+                Context::Devices().Device(),
+                &m_TransientCreateInfo,
+                nullptr,
+                &data.Buffer
+            ), "Buffer recreate transient buffer"))
+                throw std::exception();
+        }
+
+        if (!FL_VK_CHECK_RESULT(vmaBindBufferMemory2(
+            Context::Allocator(),
+            allocation,
+            offset,
+            data.Buffer,
+            nullptr
+        ), "Buffer bind transient memory"))
+            throw std::exception();
+
+        data.Allocation = allocation;
+        if (m_Info.ExposeGPUAddress)
+        {
+            VkBufferDeviceAddressInfo addInfo{};
+            addInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+            addInfo.buffer = data.Buffer;
+            data.DeviceAddress = vkGetBufferDeviceAddressKHR(Context::Devices().Device(), &addInfo);
+        }
     }
 
     void Buffer::SetBytes(const void* data, u32 byteCount, u32 byteOffset)
@@ -131,6 +216,7 @@ namespace Flourish::Vulkan
         if (write.Buffer == flush.Buffer) return;
 
         CopyBufferToBuffer(write.Buffer, flush.Buffer, 0, 0, GetAllocatedSize(), buffer, execute);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::StagingBytesUploaded, GetAllocatedSize());
     }
 
     const Buffer::BufferData& Buffer::GetGPUBufferData(u32 frameIndex) const
@@ -279,7 +365,12 @@ namespace Flourish::Vulkan
         ImageBufferCopyInternal(src, srcAspect, dst, bufferOffset, imageWidth, imageHeight, srcMipLevel, srcLayerIndex, imageLayout, true, buffer);
     }
 
-    void Buffer::AllocateStagingBuffer(VkBuffer& buffer, VmaAllocation& alloc, VmaAllocationInfo& allocInfo, u64 size)
+    void Buffer::AllocateStagingBuffer(
+        VkBuffer& buffer,
+        VmaAllocation& alloc,
+        VmaAllocationInfo& allocInfo,
+        u64 size,
+        std::string_view debugName)
     {
         VkBufferCreateInfo bufCreateInfo{};
         bufCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -299,6 +390,8 @@ namespace Flourish::Vulkan
             &allocInfo
         ), "Buffer create staging buffer"))
             throw std::exception();
+
+        Context::MemoryTracker().Track(alloc, MemoryCategory::Staging, debugName);
     }
 
     void Buffer::ImageBufferCopyInternal(
@@ -388,6 +481,8 @@ namespace Flourish::Vulkan
             ), "Buffer create buffer"))
                 throw std::exception();
 
+            Context::MemoryTracker().Track(data.Allocation, m_Info.Category, m_Info.DebugName);
+
             if (m_Info.ExposeGPUAddress)
             {
                 VkBufferDeviceAddressInfo addInfo{};
@@ -406,7 +501,8 @@ namespace Flourish::Vulkan
                 data.Buffer,
                 data.Allocation,
                 data.AllocationInfo,
-                bufCreateInfo.size
+                bufCreateInfo.size,
+                m_Info.DebugName
             );
             return allocId;
         };
@@ -488,7 +584,8 @@ namespace Flourish::Vulkan
                                 initialDataStagingBuf.Buffer,
                                 initialDataStagingBuf.Allocation,
                                 initialDataStagingBuf.AllocationInfo,
-                                bufCreateInfo.size
+                                bufCreateInfo.size,
+                                m_Info.DebugName
                             );
                         }
                         srcData = initialDataStagingBuf;
@@ -509,16 +606,12 @@ namespace Flourish::Vulkan
                     true,
                     nullptr
                 );
+                Flourish::Context::IncrementFrameCounter(FrameCounter::StagingBytesUploaded, m_Info.InitialDataSize);
             }
         }
         
         // Destroy the temp staging buffer if it was created
         if (initialDataStagingBuf.Buffer)
-        {
-            Context::FinalizerQueue().Push([initialDataStagingBuf]()
-            {
-                vmaDestroyBuffer(Context::Allocator(), initialDataStagingBuf.Buffer, initialDataStagingBuf.Allocation);
-            }, "Buffer free staging");
-        }
+            Context::FinalizerQueue().PushBuffer(initialDataStagingBuf.Buffer, initialDataStagingBuf.Allocation);
     }
 }
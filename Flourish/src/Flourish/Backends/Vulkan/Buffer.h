@@ -14,6 +14,10 @@ namespace Flourish::Vulkan
             VkBufferUsageFlags usageFlags,
             VkCommandBuffer uploadBuffer = VK_NULL_HANDLE
         );
+
+        // Transient buffers are created without memory, which is bound by the owning graph when it
+        // is built. They must be GPUOnly
+        Buffer(const BufferCreateInfo& createInfo, VkMemoryRequirements& outRequirements);
         ~Buffer() override;
 
         void SetBytes(const void* data, u32 byteCount, u32 byteOffset) override;
@@ -23,6 +27,11 @@ namespace Flourish::Vulkan
 
         void FlushInternal(VkCommandBuffer buffer, bool execute = false);
 
+        inline bool IsTransient() const { return m_IsTransient; }
+
+        // Binding a buffer that was already bound recreates it
+        void BindTransientMemory(VmaAllocation allocation, VkDeviceSize offset);
+
         // TS
         VkBuffer GetGPUBuffer(u32 frameIndex) const;
         VkBuffer GetGPUBuffer() const;
@@ -64,7 +73,13 @@ namespace Flourish::Vulkan
             VkImageLayout imageLayout,
             VkCommandBuffer buffer = VK_NULL_HANDLE
         );
-        static void AllocateStagingBuffer(VkBuffer& buffer, VmaAllocation& alloc, VmaAllocationInfo& allocInfo, u64 size);
+        static void AllocateStagingBuffer(
+            VkBuffer& buffer,
+            VmaAllocation& alloc,
+            VmaAllocationInfo& allocInfo,
+            u64 size,
+            std::string_view debugName = {}
+        );
 
     private:
         static void ImageBufferCopyInternal(
@@ -100,6 +115,8 @@ namespace Flourish::Vulkan
             VkBufferUsageFlags usage,
             VkCommandBuffer uploadBuffer
         );
+        VkBufferUsageFlags PopulateUsageFlags();
+        VkBufferCreateInfo PopulateCreateInfo(VkBufferUsageFlags usage);
         void CreateBuffers(
             VkBufferCreateInfo bufCreateInfo,
             VkCommandBuffer uploadBuffer
@@ -107,6 +124,8 @@ namespace Flourish::Vulkan
 
     private:
         u32 m_BufferCount = 1;
+        bool m_IsTransient = false;
+        VkBufferCreateInfo m_TransientCreateInfo{};
         std::vector<BufferData> m_BufferAllocations;
         std::array<u32, Flourish::Context::MaxFrameBufferCount> m_WriteBuffers;
         std::array<u32, Flourish::Context::MaxFrameBufferCount> m_FlushBuffers;
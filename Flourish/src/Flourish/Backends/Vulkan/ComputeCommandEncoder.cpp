@@ -73,6 +73,7 @@ namespace Flourish::Vulkan
         m_DescriptorBinder.BindPipelineData(m_BoundComputePipeline->GetDescriptorData());
 
         vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_BoundComputePipeline->GetPipeline());
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelinesBound);
     }
     
     void ComputeCommandEncoder::Dispatch(u32 x, u32 y, u32 z)
@@ -81,6 +82,7 @@ namespace Flourish::Vulkan
         FL_CRASH_ASSERT(m_BoundComputePipeline, "Must bind compute pipeline before dispatching");
 
         vkCmdDispatch(m_CommandBuffer, x, y, z);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Dispatches);
         m_AnyCommandRecorded = true;
     }
 
@@ -97,6 +99,7 @@ namespace Flourish::Vulkan
             buffer,
             commandOffset * sizeof(VkDispatchIndirectCommand)
         );
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Dispatches);
         m_AnyCommandRecorded = true;
     }
 
@@ -112,6 +115,7 @@ namespace Flourish::Vulkan
         m_DescriptorBinder.BindPipelineData(m_BoundRayTracingPipeline->GetDescriptorData());
 
         vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, m_BoundRayTracingPipeline->GetPipeline());
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelinesBound);
     }
 
     void ComputeCommandEncoder::TraceRays(Flourish::RayTracingGroupTable* _groupTable, u32 width, u32 height, u32 depth)
@@ -136,6 +140,7 @@ namespace Flourish::Vulkan
             height,
             depth
         );
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Dispatches);
         m_AnyCommandRecorded = true;
     }
 
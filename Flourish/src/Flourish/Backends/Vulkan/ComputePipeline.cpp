@@ -21,6 +21,8 @@ namespace Flourish::Vulkan
 
     void ComputePipeline::Recreate()
     {
+        FL_PROFILE_FUNCTION();
+
         if (m_Created)
             FL_LOG_DEBUG("Recreating compute pipeline");
 
@@ -97,15 +99,8 @@ namespace Flourish::Vulkan
 
     void ComputePipeline::Cleanup()
     {
-        auto pipeline = m_Pipeline;
-        auto layout = m_PipelineLayout;
-        Context::FinalizerQueue().Push([=]()
-        {
-            if (pipeline)
-                vkDestroyPipeline(Context::Devices().Device(), pipeline, nullptr);
-            if (layout)
-                vkDestroyPipelineLayout(Context::Devices().Device(), layout, nullptr);
-        }, "Compute pipeline free");
+        Context::FinalizerQueue().PushPipeline(m_Pipeline);
+        Context::FinalizerQueue().PushPipelineLayout(m_PipelineLayout);
 
         m_Pipeline = VK_NULL_HANDLE;
         m_PipelineLayout = VK_NULL_HANDLE;
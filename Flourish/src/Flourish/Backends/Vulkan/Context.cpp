@@ -39,10 +39,13 @@ namespace Flourish::Vulkan
         SetupInstance(initInfo);
         s_Devices.Initialize(initInfo);
         SetupAllocator();
+        s_MemoryTracker.Initialize();
         s_Queues.Initialize();
         s_Commands.Initialize();
-        s_SubmissionHandler.Initialize();
+        s_SubmissionHandler.Initialize(initInfo);
         s_FinalizerQueue.Initialize();
+        s_Timestamps.Initialize(initInfo);
+        s_Workers.Initialize(initInfo);
 
         // Create global empty descriptor set layout
         PipelineDescriptorData::Initialize();
@@ -54,6 +57,7 @@ namespace Flourish::Vulkan
     {
         FL_LOG_TRACE("Vulkan context shutdown begin");
 
+        s_SubmissionHandler.WaitOnFrameSubmissions();
         Sync();
 
         PipelineDescriptorData::Shutdown();
@@ -65,8 +69,11 @@ namespace Flourish::Vulkan
         FL_LOG_TRACE("Running vulkan finalizer pass #2");
         s_FinalizerQueue.Shutdown();
         s_Queues.Shutdown();
+        s_Workers.Shutdown();
+        s_Timestamps.Shutdown();
         s_SubmissionHandler.Shutdown();
         s_Commands.Shutdown();
+        s_MemoryTracker.Shutdown();
         vmaDestroyAllocator(s_Allocator);
         s_Devices.Shutdown();
         #if FL_DEBUG
@@ -86,12 +93,19 @@ namespace Flourish::Vulkan
     {
         vmaSetCurrentFrameIndex(s_Allocator, (u32)Flourish::Context::FrameCount());
         s_SubmissionHandler.WaitOnFrameSemaphores();
+        s_Timestamps.ResolveFrame();
     }
 
     void Context::EndFrame()
     {
         s_FinalizerQueue.Iterate();
-        s_SubmissionHandler.ProcessFrameSubmissions();
+        s_SubmissionHandler.QueueFrameSubmissions();
+        s_MemoryTracker.EndFrame();
+    }
+
+    void Context::WaitOnFrameSubmissions()
+    {
+        s_SubmissionHandler.WaitOnFrameSubmissions();
     }
 
     MemoryStatistics Context::ComputeMemoryStatistics()
@@ -117,6 +131,8 @@ namespace Flourish::Vulkan
             stats.TotalAvailable += budget.budget;
         }
 
+        s_MemoryTracker.PopulateStatistics(stats);
+
         return stats;
     }
 
@@ -143,18 +159,24 @@ namespace Flourish::Vulkan
         vkEnumerateInstanceExtensionProperties(nullptr, &supportedExtensionCount, supportedExtensions.data());
 
         // Required extensions
-        std::vector<const char*> requiredExtensions = {
-            VK_KHR_SURFACE_EXTENSION_NAME,
-            #ifdef FL_PLATFORM_WINDOWS
-                "VK_KHR_win32_surface",
-            #elif defined(FL_PLATFORM_ANDROID)
-                "VK_KHR_android_surface"
-            #elif defined(FL_PLATFORM_LINUX)
-                "VK_KHR_xcb_surface",
-            #elif defined (FL_PLATFORM_MACOS)
-                "VK_EXT_metal_surface"
-            #endif
-        };
+        std::vector<const char*> requiredExtensions;
+        if (!initInfo.Headless)
+        {
+            requiredExtensions = {
+                VK_KHR_SURFACE_EXTENSION_NAME,
+                #ifdef FL_PLATFORM_WINDOWS
+                    "VK_KHR_win32_surface",
+                #elif defined(FL_PLATFORM_ANDROID)
+                    "VK_KHR_android_surface"
+                #elif defined(FL_PLATFORM_LINUX)
+                    "VK_KHR_xcb_surface",
+                #elif defined (FL_PLATFORM_MACOS)
+                    "VK_EXT_metal_surface"
+                #endif
+            };
+        }
+        else
+        { FL_LOG_INFO("Initializing headless vulkan context, surface extensions will not be enabled"); }
 
         // Ensure compatability
         for (auto extension : requiredExtensions)
@@ -6,6 +6,9 @@
 #include "Flourish/Backends/Vulkan/Util/Commands.h"
 #include "Flourish/Backends/Vulkan/Util/FinalizerQueue.h"
 #include "Flourish/Backends/Vulkan/Util/SubmissionHandler.h"
+#include "Flourish/Backends/Vulkan/Util/TimestampQueries.h"
+#include "Flourish/Backends/Vulkan/Util/MemoryTracker.h"
+#include "Flourish/Backends/Vulkan/Util/WorkerPool.h"
 
 namespace Flourish::Vulkan
 {
@@ -23,6 +26,9 @@ namespace Flourish::Vulkan
         inline static Commands& Commands() { return s_Commands; }
         inline static FinalizerQueue& FinalizerQueue() { return s_FinalizerQueue; }
         inline static SubmissionHandler& SubmissionHandler() { return s_SubmissionHandler; }
+        inline static TimestampQueries& Timestamps() { return s_Timestamps; }
+        inline static MemoryTracker& MemoryTracker() { return s_MemoryTracker; }
+        inline static WorkerPool& Workers() { return s_Workers; }
         inline static VmaAllocator Allocator() { return s_Allocator; }
         inline static const auto& ValidationLayers() { return s_ValidationLayers; }
 
@@ -33,6 +39,7 @@ namespace Flourish::Vulkan
         static void Shutdown(std::function<void()> finalizer = nullptr);
         static void BeginFrame();
         static void EndFrame();
+        static void WaitOnFrameSubmissions();
         static MemoryStatistics ComputeMemoryStatistics();
         static void SetupInstance(const ContextInitializeInfo& initInfo);
         static void SetupAllocator();
@@ -45,6 +52,9 @@ namespace Flourish::Vulkan
         inline static Vulkan::Commands s_Commands;
         inline static Vulkan::FinalizerQueue s_FinalizerQueue;
         inline static Vulkan::SubmissionHandler s_SubmissionHandler;
+        inline static Vulkan::TimestampQueries s_Timestamps;
+        inline static Vulkan::MemoryTracker s_MemoryTracker;
+        inline static Vulkan::WorkerPool s_Workers;
         inline static VmaAllocator s_Allocator;
         inline static VkDebugUtilsMessengerEXT s_DebugMessenger = VK_NULL_HANDLE;
         inline static std::vector<const char*> s_ValidationLayers;
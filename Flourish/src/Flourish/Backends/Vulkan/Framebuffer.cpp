@@ -15,6 +15,9 @@ namespace Flourish::Vulkan
 
     Framebuffer::~Framebuffer()
     {
+        // The submission thread may still be recording the frame that referenced this
+        Context::SubmissionHandler().WaitOnSubmissionThread();
+
         Cleanup();
     }
 
@@ -188,6 +191,7 @@ namespace Flourish::Vulkan
             {
                 if (!imageData.Image) continue;
                 vkDestroyImageView(device, imageData.ImageView, nullptr);
+                Context::MemoryTracker().Untrack(imageData.Allocation);
                 vmaDestroyImage(Context::Allocator(), imageData.Image, imageData.Allocation);
             }
         }, "Framebuffer free");
@@ -209,6 +213,11 @@ namespace Flourish::Vulkan
         ), "Framebuffer create image"))
             throw std::exception();
 
+        Context::MemoryTracker().Track(
+            imageData.Allocation,
+            imgInfo.samples == VK_SAMPLE_COUNT_1_BIT ? MemoryCategory::RenderTarget : MemoryCategory::MsaaRenderTarget
+        );
+
         ImageViewCreateInfo viewCreateInfo;
         viewCreateInfo.Format = imgInfo.format;
         viewCreateInfo.MipLevels = 1;
@@ -15,6 +15,7 @@ namespace Flourish::Vulkan
     {
         m_Encoding = true;
         m_AnyCommandRecorded = false;
+        m_LayoutTracker.Reset();
 
         m_Submission.Buffers.resize(1);
         m_Submission.AllocInfo = Context::Commands().AllocateBuffers(
@@ -43,6 +44,9 @@ namespace Flourish::Vulkan
         FL_CRASH_ASSERT(m_Encoding, "Cannot end encoding that has already ended");
         m_Encoding = false;
 
+        // Textures must be back in their resting layout before the graph moves on
+        m_LayoutTracker.Restore(m_CommandBuffer);
+
         vkEndCommandBuffer(m_CommandBuffer);
 
         if (!m_AnyCommandRecorded)
@@ -64,6 +68,9 @@ namespace Flourish::Vulkan
             "Depth images can only generate mipmaps with the nearest sampler filter"
         );
 
+        // Mip generation handles its own transitions starting from the resting layout
+        m_LayoutTracker.Restore(m_CommandBuffer);
+
         Texture::GenerateMipmaps(
             texture->GetImage(),
             Common::ConvertColorFormat(texture->GetColorFormat()),
@@ -72,8 +79,8 @@ namespace Flourish::Vulkan
             texture->GetHeight(),
             texture->GetMipCount(),
             texture->GetArrayCount(),
-            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            texture->GetRestingLayout(),
+            texture->GetRestingLayout(),
             Common::ConvertSamplerFilter(filter),
             m_CommandBuffer
         );
@@ -91,33 +98,24 @@ namespace Flourish::Vulkan
         Texture* src = static_cast<Texture*>(_src);
         Texture* dst = static_cast<Texture*>(_dst);
         
-        VkImageLayout srcLayout = (src->GetUsageType() & TextureUsageFlags::Compute) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        VkImageLayout dstLayout = (src->GetUsageType() & TextureUsageFlags::Compute) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         VkImageAspectFlags srcAspect = src->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
         VkImageAspectFlags dstAspect = dst->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
 
-        Texture::TransitionImageLayout(
-            src->GetImage(),
-            srcLayout,
+        m_LayoutTracker.Require(
+            src,
+            srcLayerIndex, srcMipLevel,
             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            srcAspect,
-            srcMipLevel, 1,
-            srcLayerIndex, 1,
-            0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-            VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            m_CommandBuffer
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR,
+            VK_ACCESS_2_TRANSFER_READ_BIT_KHR
         );
-        Texture::TransitionImageLayout(
-            dst->GetImage(),
-            dstLayout,
+        m_LayoutTracker.Require(
+            dst,
+            dstLayerIndex, dstMipLevel,
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            dstAspect,
-            dstMipLevel, 1,
-            dstLayerIndex, 1,
-            0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-            VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            m_CommandBuffer
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR,
+            VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR
         );
+        m_LayoutTracker.Flush(m_CommandBuffer);
 
         Texture::Blit(
             src->GetImage(),
@@ -138,29 +136,6 @@ namespace Flourish::Vulkan
             m_CommandBuffer
         );
 
-        Texture::TransitionImageLayout(
-            dst->GetImage(),
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            dstLayout,
-            dstAspect,
-            dstMipLevel, 1,
-            dstLayerIndex, 1,
-            VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-            m_CommandBuffer
-        );
-        Texture::TransitionImageLayout(
-            src->GetImage(),
-            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            srcLayout,
-            srcAspect,
-            srcMipLevel, 1,
-            srcLayerIndex, 1,
-            VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-            m_CommandBuffer
-        );
-
         m_AnyCommandRecorded = true;
     }
 
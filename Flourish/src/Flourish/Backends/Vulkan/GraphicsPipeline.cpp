@@ -50,6 +50,8 @@ namespace Flourish::Vulkan
 
     void GraphicsPipeline::Recreate()
     {
+        FL_PROFILE_FUNCTION();
+
         if (m_Created)
             FL_LOG_DEBUG("Recreating graphics pipeline");
 
@@ -275,15 +277,9 @@ namespace Flourish::Vulkan
 
     void GraphicsPipeline::Cleanup()
     {
-        auto pipelines = m_Pipelines;
-        auto layout = m_PipelineLayout;
-        Context::FinalizerQueue().Push([=]()
-        {
-            for (auto& pair : pipelines)
-                vkDestroyPipeline(Context::Devices().Device(), pair.second, nullptr);
-            if (layout)
-                vkDestroyPipelineLayout(Context::Devices().Device(), layout, nullptr);
-        }, "Graphics pipeline free");
+        for (auto& pair : m_Pipelines)
+            Context::FinalizerQueue().PushPipeline(pair.second);
+        Context::FinalizerQueue().PushPipelineLayout(m_PipelineLayout);
 
         m_Pipelines.clear();
         m_PipelineLayout = VK_NULL_HANDLE;
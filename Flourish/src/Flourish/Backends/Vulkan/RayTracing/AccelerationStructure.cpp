@@ -3,6 +3,7 @@
 
 #include "Flourish/Backends/Vulkan/Context.h"
 #include "Flourish/Backends/Vulkan/Buffer.h"
+#include "Flourish/Backends/Vulkan/Util/Synchronization.h"
 
 namespace Flourish::Vulkan
 {
@@ -196,6 +197,7 @@ namespace Flourish::Vulkan
             ibCreateInfo.InitialData = m_Instances.data();
             ibCreateInfo.InitialDataSize = sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.InstanceCount;
             ibCreateInfo.ExposeGPUAddress = true;
+            ibCreateInfo.Category = MemoryCategory::AccelerationStructure;
             m_InstanceBuffer = std::make_shared<Buffer>(
                 ibCreateInfo,
                 VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
@@ -209,32 +211,22 @@ namespace Flourish::Vulkan
         }
 
         // Ensure data is uploaded before performing build
-        VkMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-        vkCmdPipelineBarrier(
-            cmdBuf,
-            VK_PIPELINE_STAGE_TRANSFER_BIT,
-            VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-            0,
-            1, &barrier,
-            0, nullptr,
-            0, nullptr
-        );
+        VkMemoryBarrier2KHR barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR;
+        barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+        barrier.dstAccessMask = VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+        Synchronization::GlobalBarrier(cmdBuf, barrier);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
         // Ensure all instance writes are complete
-        barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-        barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-        vkCmdPipelineBarrier(
-            cmdBuf,
-            VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-            VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-            0,
-            1, &barrier,
-            0, nullptr,
-            0, nullptr
-        );
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+        barrier.srcAccessMask = VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+        barrier.dstAccessMask = VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+        Synchronization::GlobalBarrier(cmdBuf, barrier);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
         VkAccelerationStructureGeometryKHR topGeom{};
         topGeom.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
@@ -318,6 +310,7 @@ namespace Flourish::Vulkan
             scratchCreateInfo.ElementCount = 1;
             scratchCreateInfo.Stride = scratchSize;
             scratchCreateInfo.ExposeGPUAddress = true;
+            scratchCreateInfo.Category = MemoryCategory::AccelerationStructure;
             m_ScratchBuffer = std::make_shared<Buffer>(
                 scratchCreateInfo,
                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
@@ -338,6 +331,7 @@ namespace Flourish::Vulkan
         abCreateInfo.MemoryType = BufferMemoryType::GPUOnly;
         abCreateInfo.ElementCount = 1;
         abCreateInfo.Stride = buildSize.accelerationStructureSize;
+        abCreateInfo.Category = MemoryCategory::AccelerationStructure;
 
         // Set the src BEFORE we potentially cleanup in case we need to allocate
         // a larger buffer and update
@@ -362,19 +356,14 @@ namespace Flourish::Vulkan
 
         vkCmdBuildAccelerationStructuresKHR(cmdBuf, 1, &buildInfo, &rangeInfo);
 
-        VkMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-        barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
-        vkCmdPipelineBarrier(
-            cmdBuf,
-            VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-            VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
-            0,
-            1, &barrier,
-            0, nullptr,
-            0, nullptr
-        );
+        VkMemoryBarrier2KHR barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+        barrier.srcAccessMask = VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR;
+        barrier.dstAccessMask = VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+        Synchronization::GlobalBarrier(cmdBuf, barrier);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
         // TODO: revisit this. Ideally, we free this memory when the update is done, but
         // the way it is set up now, we would have to rely on the assumption that the finalizer queue
@@ -21,6 +21,7 @@ namespace Flourish::Vulkan
         bufCreateInfo.MemoryType = BufferMemoryType::CPUWrite;
         bufCreateInfo.Stride = 1;
         bufCreateInfo.ExposeGPUAddress = true;
+        bufCreateInfo.Category = MemoryCategory::ShaderBindingTable;
 
         bufCreateInfo.ElementCount = m_AlignedHandleSize + m_BaseAlignment;
         m_Buffers[(u32)RayTracingShaderGroupType::RayGen] = std::make_shared<Buffer>(bufCreateInfo, usageFlags);
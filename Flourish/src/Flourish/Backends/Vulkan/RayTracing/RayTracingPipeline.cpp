@@ -22,6 +22,8 @@ namespace Flourish::Vulkan
     // TODO: we don't really need to recompute all of this but it's fine for now
     void RayTracingPipeline::Recreate()
     {
+        FL_PROFILE_FUNCTION();
+
         if (m_Created)
             FL_LOG_DEBUG("Recreating ray tracing pipeline");
 
@@ -169,15 +171,8 @@ namespace Flourish::Vulkan
 
     void RayTracingPipeline::Cleanup()
     {
-        auto pipeline = m_Pipeline;
-        auto layout = m_PipelineLayout;
-        Context::FinalizerQueue().Push([=]()
-        {
-            if (pipeline)
-                vkDestroyPipeline(Context::Devices().Device(), pipeline, nullptr);
-            if (layout)
-                vkDestroyPipelineLayout(Context::Devices().Device(), layout, nullptr);
-        }, "RayTracing pipeline free");
+        Context::FinalizerQueue().PushPipeline(m_Pipeline);
+        Context::FinalizerQueue().PushPipelineLayout(m_PipelineLayout);
 
         m_Pipeline = VK_NULL_HANDLE;
         m_PipelineLayout = VK_NULL_HANDLE;
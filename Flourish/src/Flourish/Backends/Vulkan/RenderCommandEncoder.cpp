@@ -78,6 +78,7 @@ namespace Flourish::Vulkan
         FL_ASSERT(subpassPipeline, "BindPipeline() pipeline not supported for current subpass");
 
         vkCmdBindPipeline(m_CurrentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, subpassPipeline);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelinesBound);
     }
 
     void RenderCommandEncoder::SetViewport(u32 x, u32 y, u32 width, u32 height)
@@ -156,6 +157,7 @@ namespace Flourish::Vulkan
         FL_CRASH_ASSERT(m_Encoding, "Cannot encode Draw after encoding has ended");
         
         vkCmdDraw(m_CurrentCommandBuffer, vertexCount, instanceCount, vertexOffset, instanceOffset);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Draws);
         m_AnyCommandRecorded = true;
     }
 
@@ -166,6 +168,7 @@ namespace Flourish::Vulkan
         FL_CRASH_ASSERT(m_Encoding, "Cannot encode DrawIndexed after encoding has ended");
 
         vkCmdDrawIndexed(m_CurrentCommandBuffer, indexCount, instanceCount, indexOffset, vertexOffset, instanceOffset);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Draws);
         m_AnyCommandRecorded = true;
     }
 
@@ -186,6 +189,7 @@ namespace Flourish::Vulkan
             drawCount,
             stride
         );
+        Flourish::Context::IncrementFrameCounter(FrameCounter::Draws);
         m_AnyCommandRecorded = true;
     }
     
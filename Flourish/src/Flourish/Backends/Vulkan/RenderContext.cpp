@@ -18,6 +18,14 @@ namespace Flourish::Vulkan
         : Flourish::RenderContext(createInfo),
          m_CommandBuffer({})
     {
+        if (m_Offscreen)
+        {
+            // Offscreen contexts have no surface and render into images owned by the swapchain
+            m_Swapchain.Initialize(createInfo, VK_NULL_HANDLE, nullptr);
+            CreateSyncObjects();
+            return;
+        }
+
         auto instance = Context::Instance();
 
         // Create the surface
@@ -49,8 +57,8 @@ namespace Flourish::Vulkan
             VkXcbSurfaceCreateInfoKHR surfaceInfo{};
             surfaceInfo.sType = VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR;
             surfaceInfo.pNext = nullptr;
-            surfaceInfo.connection = createInfo.connection;
-            surfaceInfo.window = createInfo.window;
+            surfaceInfo.connection = createInfo.Connection;
+            surfaceInfo.window = createInfo.Window;
 
             auto result = vkCreateXcbSurfaceKHR(instance, &surfaceInfo, nullptr, &m_Surface);
         #else
@@ -68,20 +76,7 @@ namespace Flourish::Vulkan
         }
 
         m_Swapchain.Initialize(createInfo, m_Surface, windowHandle);
-        
-        for (u32 frame = 0; frame < Flourish::Context::FrameBufferCount(); frame++)
-        {
-            m_SignalFences[frame] = Synchronization::CreateFence();
-
-            // Render finished semaphore
-            if (Context::Devices().SupportsTimelines())
-                m_SignalSemaphores[frame][0] = Synchronization::CreateTimelineSemaphore(0);
-            else
-                m_SignalSemaphores[frame][0] = Synchronization::CreateSemaphore();
-
-            // Swapchain semaphore
-            m_SignalSemaphores[frame][1] = Synchronization::CreateSemaphore();
-        }
+        CreateSyncObjects();
     }
 
     RenderContext::~RenderContext()
@@ -104,6 +99,23 @@ namespace Flourish::Vulkan
         }, "Render context free");
     }
 
+    void RenderContext::CreateSyncObjects()
+    {
+        for (u32 frame = 0; frame < Flourish::Context::FrameBufferCount(); frame++)
+        {
+            m_SignalFences[frame] = Synchronization::CreateFence();
+
+            // Render finished semaphore
+            if (Context::Devices().SupportsTimelines())
+                m_SignalSemaphores[frame][0] = Synchronization::CreateTimelineSemaphore(0);
+            else
+                m_SignalSemaphores[frame][0] = Synchronization::CreateSemaphore();
+
+            // Swapchain semaphore
+            m_SignalSemaphores[frame][1] = Synchronization::CreateSemaphore();
+        }
+    }
+
     void RenderContext::UpdateDimensions(u32 width, u32 height)
     {
         m_Swapchain.UpdateDimensions(width, height);
@@ -123,6 +135,11 @@ namespace Flourish::Vulkan
         return m_Swapchain.IsValid();
     }
 
+    Flourish::Texture* RenderContext::GetActiveTexture() const
+    {
+        return m_Swapchain.GetTexture();
+    }
+
     Flourish::RenderCommandEncoder* RenderContext::EncodeRenderCommands()
     {
         FL_CRASH_ASSERT(m_Swapchain.IsValid(), "Cannot encode render commands on an invalid render context");
@@ -16,6 +16,7 @@ namespace Flourish::Vulkan
         void UpdateDimensions(u32 width, u32 height) override;
         RenderPass* GetRenderPass() const override;
         bool Validate() override;
+        Flourish::Texture* GetActiveTexture() const override;
 
         [[nodiscard]] Flourish::RenderCommandEncoder* EncodeRenderCommands() override; 
 
@@ -31,6 +32,9 @@ namespace Flourish::Vulkan
         inline VkSemaphore GetImageAvailableSemaphore() const { return m_Swapchain.GetImageAvailableSemaphore(); }
         inline u64 GetSignalValue() const { return m_SignalValue; }
 
+    private:
+        void CreateSyncObjects();
+
     private:
         VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
         Vulkan::Swapchain m_Swapchain;
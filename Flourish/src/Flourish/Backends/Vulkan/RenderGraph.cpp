@@ -4,37 +4,37 @@
 #include "Flourish/Backends/Vulkan/RenderContext.h"
 #include "Flourish/Backends/Vulkan/CommandBuffer.h"
 #include "Flourish/Backends/Vulkan/Context.h"
+#include "Flourish/Backends/Vulkan/Texture.h"
+#include "Flourish/Backends/Vulkan/Buffer.h"
 #include "Flourish/Backends/Vulkan/Util/Synchronization.h"
 
+#include <cstdarg>
+
 namespace Flourish::Vulkan
 {
-    const SubmissionBarrier GRAPHICS_BARRIER = {
-        true,
-        { VK_STRUCTURE_TYPE_MEMORY_BARRIER },
-        VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-        VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT
-    };
-
-    const SubmissionBarrier COMPUTE_BARRIER = {
-        true,
-        { VK_STRUCTURE_TYPE_MEMORY_BARRIER },
-        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
-    };
-
-    const SubmissionBarrier COMPUTE_BARRIER_RT = {
-        true,
-        { VK_STRUCTURE_TYPE_MEMORY_BARRIER },
-        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR
-    };
-
-    const SubmissionBarrier TRANSFER_BARRIER = {
-        true,
-        { VK_STRUCTURE_TYPE_MEMORY_BARRIER },
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        VK_PIPELINE_STAGE_TRANSFER_BIT
-    };
+    static void AppendFormat(std::string& out, const char* format, ...)
+    {
+        char buffer[256];
+
+        va_list args;
+        va_start(args, format);
+        int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        if (length > 0)
+            out.append(buffer, std::min((int)sizeof(buffer) - 1, length));
+    }
+
+    static const char* WorkloadTypeToString(GPUWorkloadType type)
+    {
+        switch (type)
+        {
+            case GPUWorkloadType::Graphics: return "Graphics";
+            case GPUWorkloadType::Transfer: return "Transfer";
+            case GPUWorkloadType::Compute: return "Compute";
+            default: return "Unknown";
+        }
+    }
 
     RenderGraph::RenderGraph(const RenderGraphCreateInfo& createInfo)
         : Flourish::RenderGraph(createInfo)
@@ -45,17 +45,63 @@ namespace Flourish::Vulkan
 
     RenderGraph::~RenderGraph()
     {
-        auto semaphores = m_AllSemaphores;
-        auto fences = m_AllFences;
+        Context::Timestamps().ForgetGraph(this);
+
+        RetireSyncObjects();
+
+        auto heaps = m_TransientHeaps;
         Context::FinalizerQueue().Push([=]()
         {
-            for (VkSemaphore sem : semaphores)
-                vkDestroySemaphore(Context::Devices().Device(), sem, nullptr);
-            for (VkFence fence : fences)
-                vkDestroyFence(Context::Devices().Device(), fence, nullptr);
+            for (auto& heap : heaps)
+            {
+                Context::MemoryTracker().Untrack(heap.Allocation);
+                vmaFreeMemory(Context::Allocator(), heap.Allocation);
+            }
         }, "RenderGraph free");
     }
 
+    std::shared_ptr<Flourish::Texture> RenderGraph::CreateTransientTexture(const TextureCreateInfo& createInfo)
+    {
+        try
+        {
+            auto& transient = m_Transients.emplace_back();
+            auto texture = std::make_shared<Texture>(createInfo, transient.Requirements);
+            transient.Texture = texture;
+            transient.Resource = static_cast<const Flourish::Texture*>(texture.get());
+            transient.ResourceId = texture->GetId();
+            transient.ResourceType = RenderGraphResourceType::Texture;
+            return texture;
+        }
+        catch (const std::exception& e)
+        {
+            m_Transients.pop_back();
+        }
+
+        FL_ASSERT(false, "Failed to create transient texture");
+        return nullptr;
+    }
+
+    std::shared_ptr<Flourish::Buffer> RenderGraph::CreateTransientBuffer(const BufferCreateInfo& createInfo)
+    {
+        try
+        {
+            auto& transient = m_Transients.emplace_back();
+            auto buffer = std::make_shared<Buffer>(createInfo, transient.Requirements);
+            transient.Buffer = buffer;
+            transient.Resource = static_cast<const Flourish::Buffer*>(buffer.get());
+            transient.ResourceId = buffer->GetId();
+            transient.ResourceType = RenderGraphResourceType::Buffer;
+            return buffer;
+        }
+        catch (const std::exception& e)
+        {
+            m_Transients.pop_back();
+        }
+
+        FL_ASSERT(false, "Failed to create transient buffer");
+        return nullptr;
+    }
+
     void RenderGraph::AddSubmissionDependency(int fromSubmitIndex, int toSubmitIndex)
     {
         auto& toSubmit = m_ExecuteData.SubmitData[toSubmitIndex];
@@ -90,12 +136,43 @@ namespace Flourish::Vulkan
         // means each submission in the graph will depend on the last, regardless of resource dependencies.
         bool synchronous = !Context::Devices().SupportsTimelines();
 
+        // Frame resources are only waited on through timeline semaphores
+        bool trackFrameResources = Flourish::Context::FineGrainedFrameDependencies() && !synchronous;
+
+        // Build results only depend on the declared topology, so if nothing changed since the last
+        // build the existing execute data can be submitted as is
+        if (m_HasBuiltTopology && m_BuiltTopologyHash == m_TopologyHash && !m_ReschedulePending)
+        {
+            // Nodes were re-added since then, so restore which ones were culled
+            for (u32 nodeIndex : m_CulledNodes)
+                m_Nodes[nodeIndex].Culled = true;
+
+            m_Built = true;
+            m_LastBuildFrame = Flourish::Context::FrameCount();
+            return;
+        }
+
+        // Rebuilding recomputes every barrier for the new order, but submissions from earlier frames may
+        // still be using the sync objects, so those are retired rather than handed out again
+        if (m_ReschedulePending)
+        {
+            RetireSyncObjects();
+            m_ReschedulePending = false;
+        }
+
         ResetBuildVariables();
 
+        m_HasBuiltTopology = false;
         PopulateSubmissionOrder();
+        RemapResources();
+        CullNodes();
+        ScheduleSubmissionOrder();
+        PlaceTransientResources();
 
         m_Built = true;
         m_LastBuildFrame = Flourish::Context::FrameCount();
+        m_BuiltTopologyHash = m_TopologyHash;
+        m_HasBuiltTopology = true;
         if (m_ExecuteData.SubmissionOrder.empty())
             return;
         
@@ -107,14 +184,13 @@ namespace Flourish::Vulkan
         GPUWorkloadType currentWorkloadType;
         for (u32 orderIndex = 0; orderIndex < m_ExecuteData.SubmissionOrder.size(); orderIndex++)
         {
-            RenderGraphNode& node = m_Nodes[m_ExecuteData.SubmissionOrder[orderIndex]];
-            CommandBuffer* buffer = static_cast<CommandBuffer*>(node.Buffer);
-            for (u32 subIndex = 0; subIndex < node.EncoderNodes.size(); subIndex++)
+            auto& node = m_Nodes[m_ExecuteData.SubmissionOrder[orderIndex]];
+            for (u32 subIndex = 0; subIndex < node.EncoderCount; subIndex++)
             {
                 // Insert a sync for each submission, since we may need to barrier after each command
                 m_ExecuteData.SubmissionSyncs.emplace_back();
 
-                auto& submission = node.EncoderNodes[subIndex];
+                auto& submission = m_Encoders[node.EncoderOffset + subIndex];
                 u32 queueIndex = Context::Queues().QueueIndex(submission.WorkloadType);
                 bool firstSub = orderIndex == 0 && subIndex == 0;
                 bool queueChange = !firstSub && queueIndex != Context::Queues().QueueIndex(currentWorkloadType);
@@ -165,28 +241,92 @@ namespace Flourish::Vulkan
                 auto& currentSync = m_ExecuteData.SubmissionSyncs[totalIndex];
                 auto& workloadSync = m_ExecuteData.SubmissionSyncs[currentWorkloadIndex];
 
+                // Transient resources start out undefined at their first use, which must wait on everything that
+                // previously used their memory. Uses are tracked per workload so that later aliases can wait on them
+                for (u32 usageIndex = submission.UsageOffset; usageIndex < submission.UsageOffset + submission.UsageCount; usageIndex++)
+                {
+                    int transientIndex = m_AllResources[m_UsageResourceIndices[usageIndex]].TransientIndex;
+                    if (transientIndex == -1)
+                        continue;
+                    auto& usage = m_ResourceUsages[usageIndex];
+                    auto& transient = m_Transients[transientIndex];
+                    u32 workload = static_cast<u32>(submission.WorkloadType);
+
+                    VkPipelineStageFlags2KHR stages = 0;
+                    VkAccessFlags2KHR access = 0;
+                    VkPipelineStageFlags2KHR usageStages;
+                    VkAccessFlags2KHR usageAccess;
+                    if (usage.Access & RenderGraphResourceAccessFlags::Read)
+                    {
+                        GetUsageFlags(usage, submission.WorkloadType, false, usageStages, usageAccess);
+                        stages |= usageStages;
+                        access |= usageAccess;
+                    }
+                    if (usage.Access & RenderGraphResourceAccessFlags::Write)
+                    {
+                        GetUsageFlags(usage, submission.WorkloadType, true, usageStages, usageAccess);
+                        stages |= usageStages;
+                        access |= usageAccess;
+                        transient.LastUseAccess[workload] |= usageAccess;
+                    }
+
+                    if (transient.FirstUse == static_cast<int>(totalIndex))
+                    {
+                        AddAliasingBarrier(
+                            currentSync.Barrier, usage, transientIndex,
+                            workloadSync.SubmitDataIndex, queueIndex, synchronous,
+                            stages, access
+                        );
+                    }
+
+                    transient.LastUseWorkloadIndices[workload] = currentWorkloadIndex;
+                    transient.LastUseStages[workload] |= stages;
+                }
+
                 // Process all read resources and check for any dependencies that need to be resolved
-                for (u64 read : submission.ReadResources)
+                for (u32 usageIndex = submission.UsageOffset; usageIndex < submission.UsageOffset + submission.UsageCount; usageIndex++)
                 {
-                    auto resource = m_AllResources.find(read);
-                    if (resource == m_AllResources.end())
+                    auto& usage = m_ResourceUsages[usageIndex];
+                    if (!(usage.Access & RenderGraphResourceAccessFlags::Read))
                         continue;
-                    auto& resourceInfo = resource->second;
+                    auto& resourceInfo = m_AllResources[m_UsageResourceIndices[usageIndex]];
+
+                    VkPipelineStageFlags2KHR dstStages;
+                    VkAccessFlags2KHR dstAccess;
+                    GetUsageFlags(usage, submission.WorkloadType, false, dstStages, dstAccess);
+
+                    // Track reads so that the next write on this queue can wait for them to finish
+                    if (resourceInfo.ReadQueue != queueIndex)
+                    {
+                        resourceInfo.ReadStages = 0;
+                        resourceInfo.PriorReadStages = 0;
+                    }
+                    if (resourceInfo.LastReadIndex != static_cast<int>(totalIndex))
+                        resourceInfo.PriorReadStages = resourceInfo.ReadStages;
+                    resourceInfo.ReadQueue = queueIndex;
+                    resourceInfo.ReadStages |= dstStages;
+                    resourceInfo.LastReadIndex = totalIndex;
+
                     if (resourceInfo.LastWriteIndex == -1)
                         continue;
 
                     u32 lastWriteQueue = Context::Queues().QueueIndex(resourceInfo.LastWriteWorkload);
                     if (lastWriteQueue == queueIndex)
                     {
-                        // If the queues between write -> read match, we must sync via a memory barrier. However, we only
-                        // need to do this if we have not already waited on a memory barrier for this same sesource (i.e.
-                        // if the write occured before the last wait, we do not need to wait again)
+                        // If the queues between write -> read match, we must sync via a barrier on this resource. However, we only
+                        // need to do this for the stages and accesses that have not already waited on the last write (i.e. a
+                        // previous reader in the same stage already made the write visible)
 
-                        bool wroteAfterLastBarrier = resourceInfo.LastWriteIndex > m_LastWaitWrites[queueIndex];
-                        if (wroteAfterLastBarrier)
+                        bool needsBarrier = (dstStages & ~resourceInfo.SyncedStages) || (dstAccess & ~resourceInfo.SyncedAccess);
+                        if (needsBarrier)
                         {
-                            PopulateSubmissionBarrier(currentSync.Barrier, resourceInfo.LastWriteWorkload, submission.WorkloadType);
-                            m_LastWaitWrites[queueIndex] = resourceInfo.LastWriteIndex;
+                            AddWriteBarrier(
+                                currentSync.Barrier, resourceInfo, usageIndex,
+                                totalIndex, currentWorkloadIndex,
+                                dstStages, dstAccess
+                            );
+                            resourceInfo.SyncedStages |= dstStages;
+                            resourceInfo.SyncedAccess |= dstAccess;
                         }
                     }
                     else if (!synchronous)
@@ -202,23 +342,33 @@ namespace Flourish::Vulkan
                 }
 
                 // Process all write resources and check for any dependencies that need to be resolved
-                for (u64 write : submission.WriteResources)
+                for (u32 usageIndex = submission.UsageOffset; usageIndex < submission.UsageOffset + submission.UsageCount; usageIndex++)
                 {
-                    auto& resourceInfo = m_AllResources[write];
+                    auto& usage = m_ResourceUsages[usageIndex];
+                    if (!(usage.Access & RenderGraphResourceAccessFlags::Write))
+                        continue;
+                    auto& resourceInfo = m_AllResources[m_UsageResourceIndices[usageIndex]];
+
+                    VkPipelineStageFlags2KHR dstStages;
+                    VkAccessFlags2KHR dstAccess;
+                    GetUsageFlags(usage, submission.WorkloadType, true, dstStages, dstAccess);
 
                     u32 lastWriteQueue = Context::Queues().QueueIndex(resourceInfo.LastWriteWorkload);
                     bool wasWritten = resourceInfo.LastWriteIndex != -1;
                     if (wasWritten && lastWriteQueue == queueIndex)
                     {
-                        // If the queues between write -> write match, we must sync via a memory barrier in order to prevent
-                        // a write-after-write hazard. Similar to reads, we don't need to insert another barrier if we've already waited
-                        // in this queue
+                        // If the queues between write -> write match, we must sync via a barrier in order to prevent
+                        // a write-after-write hazard. Similar to reads, we don't need to insert another barrier if these
+                        // stages have already waited on the last write
 
-                        bool wroteAfterLastBarrier = resourceInfo.LastWriteIndex > m_LastWaitWrites[queueIndex];
-                        if (wroteAfterLastBarrier)
+                        bool needsBarrier = (dstStages & ~resourceInfo.SyncedStages) || (dstAccess & ~resourceInfo.SyncedAccess);
+                        if (needsBarrier)
                         {
-                            PopulateSubmissionBarrier(currentSync.Barrier, resourceInfo.LastWriteWorkload, submission.WorkloadType);
-                            m_LastWaitWrites[queueIndex] = totalIndex;
+                            AddWriteBarrier(
+                                currentSync.Barrier, resourceInfo, usageIndex,
+                                totalIndex, currentWorkloadIndex,
+                                dstStages, dstAccess
+                            );
                         }
                     }
                     else if (wasWritten && !synchronous)
@@ -234,15 +384,79 @@ namespace Flourish::Vulkan
                         AddSubmissionDependency(fromSubmitIndex, workloadSync.SubmitDataIndex);
                     }
 
+                    // Earlier reads on this queue must finish before the write starts. This only requires an execution
+                    // dependency, and reads from this same submission are ordered by the submission itself, so when it
+                    // also read the resource only the reads of earlier submissions are waited on
+                    VkPipelineStageFlags2KHR readStages = resourceInfo.LastReadIndex == static_cast<int>(totalIndex)
+                        ? resourceInfo.PriorReadStages
+                        : resourceInfo.ReadStages;
+                    if (readStages && resourceInfo.ReadQueue == queueIndex)
+                    {
+                        currentSync.Barrier.ShouldBarrier = true;
+                        currentSync.Barrier.MemoryBarrier.srcStageMask |= readStages;
+                        currentSync.Barrier.MemoryBarrier.dstStageMask |= dstStages;
+                    }
+
                     resourceInfo.LastWriteIndex = totalIndex;
                     resourceInfo.LastWriteWorkloadIndex = currentWorkloadIndex;
                     resourceInfo.LastWriteWorkload = currentWorkloadType;
+                    resourceInfo.LastWriteStages = dstStages;
+                    resourceInfo.LastWriteAccess = dstAccess;
+                    resourceInfo.SyncedStages = 0;
+                    resourceInfo.SyncedAccess = 0;
+                    resourceInfo.ReadStages = 0;
+                    resourceInfo.PriorReadStages = 0;
+                }
+
+                // Split barriers are added last so that each keeps a contiguous range of resource barriers
+                if (!m_PendingSplits.empty())
+                    AddSplitBarriers(currentSync);
+
+                // Record how the graph as a whole uses each resource so that other frames only wait on the
+                // submissions that touch it. Transients are never shared with other graphs
+                if (trackFrameResources)
+                {
+                    for (u32 usageIndex = submission.UsageOffset; usageIndex < submission.UsageOffset + submission.UsageCount; usageIndex++)
+                    {
+                        auto& usage = m_ResourceUsages[usageIndex];
+                        u32 resourceIndex = m_UsageResourceIndices[usageIndex];
+                        auto& resourceInfo = m_AllResources[resourceIndex];
+                        if (resourceInfo.TransientIndex != -1)
+                            continue;
+
+                        if (resourceInfo.FirstUseSubmitIndex == -1)
+                            resourceInfo.FirstUseSubmitIndex = workloadSync.SubmitDataIndex;
+                        resourceInfo.FrameAccess |= usage.Access;
+
+                        // Reads before a write are ordered by the graph, so only the ones after it are kept
+                        if (usage.Access & RenderGraphResourceAccessFlags::Write)
+                            resourceInfo.FrameReadStart = m_FrameReadUses.size();
+                        if (usage.Access & RenderGraphResourceAccessFlags::Read)
+                            m_FrameReadUses.emplace_back(resourceIndex, workloadSync.SubmitDataIndex);
+                    }
                 }
 
                 totalIndex++;
             }
         }
 
+        // Events are set after their producing encoder, so index the split barriers by it as well
+        auto& splitSets = m_ExecuteData.SplitBarrierSets;
+        splitSets.resize(m_ExecuteData.SplitBarriers.size());
+        for (u32 i = 0; i < splitSets.size(); i++)
+            splitSets[i] = i;
+        std::stable_sort(splitSets.begin(), splitSets.end(), [this](u32 a, u32 b)
+        {
+            return m_ExecuteData.SplitBarriers[a].SetIndex < m_ExecuteData.SplitBarriers[b].SetIndex;
+        });
+        for (u32 i = 0; i < splitSets.size(); i++)
+        {
+            auto& setSync = m_ExecuteData.SubmissionSyncs[m_ExecuteData.SplitBarriers[splitSets[i]].SetIndex];
+            if (setSync.SplitSetCount == 0)
+                setSync.SplitSetOffset = i;
+            setSync.SplitSetCount++;
+        }
+
         // Add completion semaphores
         for (auto& info : m_ExecuteData.SubmitData)
         {
@@ -269,6 +483,63 @@ namespace Flourish::Vulkan
         // Finalize submit info
         for (auto& info : m_ExecuteData.SubmitData)
             info.TimelineSubmitInfo.pWaitSemaphoreValues = m_ExecuteData.WaitSemaphoreValues.data();
+
+        if (trackFrameResources)
+            PopulateFrameResources();
+    }
+
+    void RenderGraph::StoreTimestamp(u64 frame, u64 nodeId, u32 encoderIndex, d64 start, d64 end)
+    {
+        // Results from a newer submission replace everything so that removed nodes do not linger
+        if (frame > m_TimestampFrame)
+        {
+            m_Timestamps.clear();
+            m_TimestampFrame = frame;
+        }
+
+        auto& timestamps = m_Timestamps[nodeId];
+        if (timestamps.size() <= encoderIndex)
+            timestamps.resize(encoderIndex + 1);
+        timestamps[encoderIndex] = { start, end };
+    }
+
+    void RenderGraph::StoreRecordTime(u64 nodeId, d64 nanoseconds)
+    {
+        // Like timestamps, only the latest submission is kept
+        if (Flourish::Context::FrameCount() != m_RecordTimeFrame)
+        {
+            m_RecordTimes.clear();
+            m_RecordTimeFrame = Flourish::Context::FrameCount();
+        }
+
+        m_RecordTimes[nodeId] = nanoseconds;
+    }
+
+    std::string RenderGraph::Export(RenderGraphExportFormat format, bool includeTimings) const
+    {
+        if (!m_Built)
+        {
+            FL_LOG_WARN("Exporting a RenderGraph that has not been built");
+            return std::string();
+        }
+
+        // Encoders are laid out in submission order, so walking the syncs recovers the submission each
+        // encoder is recorded into
+        std::vector<int> encoderSubmits(m_ExecuteData.SubmissionSyncs.size());
+        int submitIndex = -1;
+        for (u32 i = 0; i < m_ExecuteData.SubmissionSyncs.size(); i++)
+        {
+            if (m_ExecuteData.SubmissionSyncs[i].SubmitDataIndex != -1)
+                submitIndex = m_ExecuteData.SubmissionSyncs[i].SubmitDataIndex;
+            encoderSubmits[i] = submitIndex;
+        }
+
+        switch (format)
+        {
+            default: return std::string();
+            case RenderGraphExportFormat::Dot: return ExportDot(encoderSubmits, includeTimings);
+            case RenderGraphExportFormat::Json: return ExportJson(encoderSubmits, includeTimings);
+        }
     }
 
     // TODO: think about removing this state
@@ -294,6 +565,16 @@ namespace Flourish::Vulkan
 
         m_LastSubmissionFrame = Flourish::Context::FrameCount();
 
+        // Graphs that keep their topology are otherwise only scheduled once, usually before any of their
+        // timestamps exist. The commands for this submission are already encoded, so graphs whose transients
+        // could move are left for their next Build
+        if (m_Info.Usage != RenderGraphUsageType::Once && ShouldReschedule())
+        {
+            m_ReschedulePending = true;
+            if (m_Transients.empty())
+                RenderGraph::Build();
+        }
+
         if (Context::Devices().SupportsTimelines())
         {
             // Don't bother with this if we are not using timelines
@@ -307,6 +588,58 @@ namespace Flourish::Vulkan
         }
     }
 
+    bool RenderGraph::ShouldReschedule()
+    {
+        // Costs only affect the schedule when it prioritizes nodes
+        if (!m_SchedulePrioritized || m_ScheduledCosts.size() != m_Nodes.size())
+            return false;
+        if (Flourish::Context::FrameCount() - m_ScheduleCheckFrame < RescheduleCheckInterval)
+            return false;
+        m_ScheduleCheckFrame = Flourish::Context::FrameCount();
+
+        for (u32 i = 0; i < m_Nodes.size(); i++)
+        {
+            if (m_Nodes[i].Culled)
+                continue;
+
+            // Measured times replace hints as soon as they exist. After that only drift that is large both
+            // relative to the node and in absolute terms is worth a new schedule
+            d64 scheduled = m_ScheduledCosts[i];
+            d64 measured = GetNodeGpuTime(m_Nodes[i]);
+            if (measured <= 0)
+                continue;
+            if (scheduled <= 0)
+                return true;
+            d64 drift = std::abs(measured - scheduled);
+            if (drift > RescheduleMinDrift && drift > scheduled * RescheduleDriftRatio)
+                return true;
+        }
+
+        return false;
+    }
+
+    void RenderGraph::RetireSyncObjects()
+    {
+        if (m_AllSemaphores.empty() && m_AllFences.empty() && m_AllEvents.empty())
+            return;
+
+        auto semaphores = std::move(m_AllSemaphores);
+        auto fences = std::move(m_AllFences);
+        auto events = std::move(m_AllEvents);
+        m_AllSemaphores.clear();
+        m_AllFences.clear();
+        m_AllEvents.clear();
+        Context::FinalizerQueue().Push([=]()
+        {
+            for (VkSemaphore sem : semaphores)
+                vkDestroySemaphore(Context::Devices().Device(), sem, nullptr);
+            for (VkFence fence : fences)
+                vkDestroyFence(Context::Devices().Device(), fence, nullptr);
+            for (VkEvent event : events)
+                vkDestroyEvent(Context::Devices().Device(), event, nullptr);
+        }, "RenderGraph sync objects free");
+    }
+
     u32 RenderGraph::GetExecutionFrameIndex() const
     {
         return m_Info.Usage == RenderGraphUsageType::PerFrame ? Flourish::Context::FrameIndex() : 0;
@@ -316,14 +649,20 @@ namespace Flourish::Vulkan
     {
         m_FreeSemaphoreIndex = 0;
         m_FreeFenceIndex = 0;
+        m_FreeEventIndex = 0;
 
-        m_LastWaitWrites.clear();
         m_ExecuteData.SubmissionOrder.clear();
         m_ExecuteData.SubmissionSyncs.clear();
+        m_ExecuteData.ResourceBarriers.clear();
+        m_ExecuteData.SplitBarriers.clear();
+        m_ExecuteData.SplitBarrierSets.clear();
+        m_PendingSplits.clear();
         m_ExecuteData.SubmitData.clear();
-        m_TemporarySubmissionOrder.clear();
+        m_ExecuteData.FrameResources.clear();
+        m_ExecuteData.FrameResourceReads.clear();
+        m_ExecuteData.ConservativeFrameSync = true;
         m_AllResources.clear();
-        m_VisitedNodes.clear();
+        m_FrameReadUses.clear();
         for (u32 i = 0; i < m_SyncObjectCount; i++)
         {
             m_ExecuteData.CompletionSemaphores[i].clear();
@@ -331,35 +670,755 @@ namespace Flourish::Vulkan
         }
     }
 
+    void RenderGraph::RemapResources()
+    {
+        // Compact every referenced resource id into a dense index so that the build only touches
+        // flat arrays
+        m_ResourceIds.resize(m_ResourceUsages.size());
+        for (u32 i = 0; i < m_ResourceUsages.size(); i++)
+            m_ResourceIds[i] = m_ResourceUsages[i].ResourceId;
+        std::sort(m_ResourceIds.begin(), m_ResourceIds.end());
+        m_ResourceIds.erase(std::unique(m_ResourceIds.begin(), m_ResourceIds.end()), m_ResourceIds.end());
+
+        m_AllResources.assign(m_ResourceIds.size(), ResourceSyncInfo());
+        m_UsageResourceIndices.resize(m_ResourceUsages.size());
+        for (u32 i = 0; i < m_ResourceUsages.size(); i++)
+        {
+            auto found = std::lower_bound(m_ResourceIds.begin(), m_ResourceIds.end(), m_ResourceUsages[i].ResourceId);
+            m_UsageResourceIndices[i] = static_cast<u32>(found - m_ResourceIds.begin());
+        }
+    }
+
     void RenderGraph::PopulateSubmissionOrder()
     {
-        for (auto& id : m_Leaves)
-            m_ProcessingNodes.emplace(id);
+        u32 nodeCount = static_cast<u32>(m_Nodes.size());
+
+        // Resolve dependency ids into a flat per node list of node indices. Late dependencies are
+        // placed after the node's own, using the dependent counts as temporary write cursors
+        m_DependencyOffsets.assign(nodeCount + 1, 0);
+        for (u32 i = 0; i < nodeCount; i++)
+            m_DependencyOffsets[i + 1] = m_Nodes[i].DependencyCount;
+        for (auto& late : m_LateDependencies)
+            m_DependencyOffsets[FindNodeIndex(late.first) + 1]++;
+        for (u32 i = 0; i < nodeCount; i++)
+            m_DependencyOffsets[i + 1] += m_DependencyOffsets[i];
+
+        const auto resolve = [this](u64 id)
+        {
+            u32 index = FindNodeIndex(id);
+            return index == RenderGraphIndexTable::InvalidIndex ? InvalidNode : index;
+        };
 
-        // Produce initial bfs ordering
-        u32 totalSubmissions = 0;
-        while (!m_ProcessingNodes.empty())
+        m_NodeDependencies.resize(m_DependencyOffsets[nodeCount]);
+        m_DependentCounts.assign(nodeCount, 0);
+        for (u32 i = 0; i < nodeCount; i++)
+        {
+            auto& node = m_Nodes[i];
+            for (u32 j = 0; j < node.DependencyCount; j++)
+                m_NodeDependencies[m_DependencyOffsets[i] + j] = resolve(m_Dependencies[node.DependencyOffset + j]);
+            m_DependentCounts[i] = node.DependencyCount;
+        }
+        for (auto& late : m_LateDependencies)
+        {
+            u32 nodeIndex = FindNodeIndex(late.first);
+            m_NodeDependencies[m_DependencyOffsets[nodeIndex] + m_DependentCounts[nodeIndex]++] = resolve(late.second);
+        }
+
+        // Kahn's algorithm over the reversed edges. A node is only emitted once everything that
+        // depends on it has been emitted, so reversing the result puts dependencies first. Ready nodes
+        // are taken in FIFO order, which gives a valid topological order but no particular layering.
+        // This stays O(V + E) no matter how many paths lead to a node
+        m_DependentCounts.assign(nodeCount, 0);
+        for (u32 dep : m_NodeDependencies)
+            if (dep != InvalidNode)
+                m_DependentCounts[dep]++;
+
+        // The order doubles as the processing queue
+        auto& order = m_ExecuteData.SubmissionOrder;
+        order.reserve(nodeCount);
+        for (u32 i = 0; i < nodeCount; i++)
+            if (m_DependentCounts[i] == 0)
+                order.emplace_back(i);
+        for (u32 head = 0; head < order.size(); head++)
+        {
+            u32 nodeIndex = order[head];
+            for (u32 i = m_DependencyOffsets[nodeIndex]; i < m_DependencyOffsets[nodeIndex + 1]; i++)
+            {
+                u32 dep = m_NodeDependencies[i];
+                if (dep != InvalidNode && --m_DependentCounts[dep] == 0)
+                    order.emplace_back(dep);
+            }
+        }
+
+        // Any node that was never emitted is either part of a cycle or depended on by one
+        if (order.size() != nodeCount)
+        {
+            ReportDependencyCycle();
+            order.clear();
+            throw std::exception();
+        }
+
+        std::reverse(order.begin(), order.end());
+    }
+
+    void RenderGraph::ReportDependencyCycle()
+    {
+        // Dfs over the nodes left with dependents after ordering, which always finds a back edge
+        u32 nodeCount = static_cast<u32>(m_Nodes.size());
+        std::vector<bool> visited(nodeCount, false);
+        std::vector<int> pathIndices(nodeCount, -1);
+        std::vector<std::pair<u32, u32>> stack; // Node index, next dependency edge
+        for (u32 start = 0; start < nodeCount; start++)
         {
-            u64 nodeId = m_ProcessingNodes.front();
-            m_ProcessingNodes.pop();
+            if (m_DependentCounts[start] == 0 || visited[start])
+                continue;
+
+            visited[start] = true;
+            pathIndices[start] = 0;
+            stack.emplace_back(start, m_DependencyOffsets[start]);
+            while (!stack.empty())
+            {
+                u32 nodeIndex = stack.back().first;
+                u32 edge = stack.back().second;
+                if (edge == m_DependencyOffsets[nodeIndex + 1])
+                {
+                    pathIndices[nodeIndex] = -1;
+                    stack.pop_back();
+                    continue;
+                }
+
+                stack.back().second++;
+                u32 dep = m_NodeDependencies[edge];
+                if (dep == InvalidNode)
+                    continue;
+
+                if (pathIndices[dep] != -1)
+                {
+                    std::string cycle;
+                    for (u32 i = pathIndices[dep]; i < stack.size(); i++)
+                        cycle += std::to_string(m_Nodes[stack[i].first].Id) + " -> ";
+                    cycle += std::to_string(m_Nodes[dep].Id);
 
-            auto& node = m_Nodes[nodeId];
-            for (u64 depId : node.ExecutionDependencies)
-                m_ProcessingNodes.emplace(depId);
+                    FL_LOG_ERROR("RenderGraph has a dependency cycle between command buffers %s", cycle.c_str());
+                    return;
+                }
+
+                if (visited[dep])
+                    continue;
 
-            m_TemporarySubmissionOrder.emplace_back(nodeId);
+                visited[dep] = true;
+                pathIndices[dep] = static_cast<int>(stack.size());
+                stack.emplace_back(dep, m_DependencyOffsets[dep]);
+            }
         }
 
-        // Traverse the ordering backwards removing duplicates to produce
-        // final topo order
-        for (int i = m_TemporarySubmissionOrder.size() - 1; i >= 0; i--)
+        FL_LOG_ERROR("RenderGraph has a dependency cycle");
+    }
+
+    void RenderGraph::CullNodes()
+    {
+        // Walk the order backwards so that every node which could consume a node's writes is visited first.
+        // Nodes survive when they have side effects, when a surviving node depends on them, or when they
+        // write a resource that a surviving node reads. Writes are not assumed to cover the whole resource,
+        // so every earlier writer of a read resource survives
+        auto& order = m_ExecuteData.SubmissionOrder;
+        m_RequiredNodes.assign(m_Nodes.size(), 0);
+        m_RequiredResources.assign(m_ResourceIds.size(), 0);
+        m_CulledNodes.clear();
+        for (u32 i = static_cast<u32>(order.size()); i > 0; i--)
         {
-            u64 id = m_TemporarySubmissionOrder[i];
-            if (m_VisitedNodes.find(id) != m_VisitedNodes.end())
+            u32 nodeIndex = order[i - 1];
+            auto& node = m_Nodes[nodeIndex];
+            u32 usageBegin = node.EncoderCount > 0 ? m_Encoders[node.EncoderOffset].UsageOffset : 0;
+            u32 usageEnd = usageBegin;
+            if (node.EncoderCount > 0)
+            {
+                auto& lastEncoder = m_Encoders[node.EncoderOffset + node.EncoderCount - 1];
+                usageEnd = lastEncoder.UsageOffset + lastEncoder.UsageCount;
+            }
+
+            bool required = node.HasSideEffects || m_RequiredNodes[nodeIndex];
+            for (u32 usageIndex = usageBegin; usageIndex < usageEnd && !required; usageIndex++)
+            {
+                if (m_ResourceUsages[usageIndex].Access & RenderGraphResourceAccessFlags::Write)
+                    required = m_RequiredResources[m_UsageResourceIndices[usageIndex]];
+            }
+
+            if (!required)
+            {
+                node.Culled = true;
+                m_CulledNodes.emplace_back(nodeIndex);
                 continue;
-            m_VisitedNodes.emplace(id);
-            m_ExecuteData.SubmissionOrder.emplace_back(id);
+            }
+
+            for (u32 usageIndex = usageBegin; usageIndex < usageEnd; usageIndex++)
+                if (m_ResourceUsages[usageIndex].Access & RenderGraphResourceAccessFlags::Read)
+                    m_RequiredResources[m_UsageResourceIndices[usageIndex]] = 1;
+            for (u32 j = m_DependencyOffsets[nodeIndex]; j < m_DependencyOffsets[nodeIndex + 1]; j++)
+                if (m_NodeDependencies[j] != InvalidNode)
+                    m_RequiredNodes[m_NodeDependencies[j]] = 1;
         }
+
+        if (m_CulledNodes.empty())
+            return;
+
+        order.erase(
+            std::remove_if(order.begin(), order.end(), [this](u32 nodeIndex) { return m_Nodes[nodeIndex].Culled; }),
+            order.end()
+        );
+
+        FL_LOG_DEBUG("RenderGraph culled %d of %d nodes", static_cast<u32>(m_CulledNodes.size()), static_cast<u32>(m_Nodes.size()));
+    }
+
+    void RenderGraph::ScheduleSubmissionOrder()
+    {
+        m_SchedulePrioritized = false;
+        m_ScheduleCheckFrame = Flourish::Context::FrameCount();
+
+        auto& order = m_ExecuteData.SubmissionOrder;
+        if (order.size() < 2)
+            return;
+
+        FL_PROFILE_FUNCTION();
+
+        u32 submissionsBefore = CountSubmissions();
+
+        u32 nodeCount = static_cast<u32>(m_Nodes.size());
+        u32 orderCount = static_cast<u32>(order.size());
+
+        // Constraints are the explicit dependencies plus every resource hazard in the current order, so the
+        // schedule only ever moves nodes that are independent of each other. Culled nodes are left out
+        m_ScheduleEdges.clear();
+        for (u32 i = 0; i < nodeCount; i++)
+        {
+            if (m_Nodes[i].Culled)
+                continue;
+            for (u32 j = m_DependencyOffsets[i]; j < m_DependencyOffsets[i + 1]; j++)
+                if (m_NodeDependencies[j] != InvalidNode && !m_Nodes[m_NodeDependencies[j]].Culled)
+                    m_ScheduleEdges.emplace_back(m_NodeDependencies[j], i);
+        }
+
+        m_ResourceWriters.assign(m_ResourceIds.size(), -1);
+        m_ResourceReaders.assign(m_ResourceIds.size(), -1);
+        m_ReaderLinks.clear();
+        for (u32 nodeIndex : order)
+        {
+            auto& node = m_Nodes[nodeIndex];
+            for (u32 encoderIndex = node.EncoderOffset; encoderIndex < node.EncoderOffset + node.EncoderCount; encoderIndex++)
+            {
+                auto& encoder = m_Encoders[encoderIndex];
+                for (u32 usageIndex = encoder.UsageOffset; usageIndex < encoder.UsageOffset + encoder.UsageCount; usageIndex++)
+                {
+                    if (!(m_ResourceUsages[usageIndex].Access & RenderGraphResourceAccessFlags::Read))
+                        continue;
+
+                    u32 resource = m_UsageResourceIndices[usageIndex];
+                    int writer = m_ResourceWriters[resource];
+                    if (writer != -1 && writer != static_cast<int>(nodeIndex))
+                        m_ScheduleEdges.emplace_back(writer, nodeIndex);
+                    m_ReaderLinks.emplace_back(nodeIndex, m_ResourceReaders[resource]);
+                    m_ResourceReaders[resource] = static_cast<int>(m_ReaderLinks.size() - 1);
+                }
+            }
+            for (u32 encoderIndex = node.EncoderOffset; encoderIndex < node.EncoderOffset + node.EncoderCount; encoderIndex++)
+            {
+                auto& encoder = m_Encoders[encoderIndex];
+                for (u32 usageIndex = encoder.UsageOffset; usageIndex < encoder.UsageOffset + encoder.UsageCount; usageIndex++)
+                {
+                    if (!(m_ResourceUsages[usageIndex].Access & RenderGraphResourceAccessFlags::Write))
+                        continue;
+
+                    u32 resource = m_UsageResourceIndices[usageIndex];
+                    int writer = m_ResourceWriters[resource];
+                    if (writer != -1 && writer != static_cast<int>(nodeIndex))
+                        m_ScheduleEdges.emplace_back(writer, nodeIndex);
+                    for (int link = m_ResourceReaders[resource]; link != -1; link = m_ReaderLinks[link].second)
+                        if (m_ReaderLinks[link].first != nodeIndex)
+                            m_ScheduleEdges.emplace_back(m_ReaderLinks[link].first, nodeIndex);
+                    m_ResourceReaders[resource] = -1;
+                    m_ResourceWriters[resource] = static_cast<int>(nodeIndex);
+                }
+            }
+        }
+
+        // Flatten the constraints into per node successor ranges, using the dependent counts as write cursors
+        m_SuccessorOffsets.assign(nodeCount + 1, 0);
+        for (auto& edge : m_ScheduleEdges)
+            m_SuccessorOffsets[edge.first + 1]++;
+        for (u32 i = 0; i < nodeCount; i++)
+            m_SuccessorOffsets[i + 1] += m_SuccessorOffsets[i];
+        m_Successors.resize(m_ScheduleEdges.size());
+        m_DependentCounts.assign(nodeCount, 0);
+        for (auto& edge : m_ScheduleEdges)
+            m_Successors[m_SuccessorOffsets[edge.first] + m_DependentCounts[edge.first]++] = edge.second;
+
+        // Workloads are grouped by the queue they run on. Encoderless nodes never submit anything, so
+        // they get their own slot which is always drained first
+        const auto queueSlot = [](GPUWorkloadType workload)
+        {
+            u32 queueIndex = Context::Queues().QueueIndex(workload);
+            for (u32 slot = 0; slot < 3; slot++)
+                if (Context::Queues().QueueIndex(static_cast<GPUWorkloadType>(slot)) == queueIndex)
+                    return slot;
+            return 0u;
+        };
+
+        m_EntryQueueSlots.resize(nodeCount);
+        m_ExitQueueSlots.resize(nodeCount);
+        for (u32 i = 0; i < nodeCount; i++)
+        {
+            auto& node = m_Nodes[i];
+            if (node.EncoderCount == 0)
+            {
+                m_EntryQueueSlots[i] = EncoderlessQueueSlot;
+                m_ExitQueueSlots[i] = EncoderlessQueueSlot;
+                continue;
+            }
+
+            m_EntryQueueSlots[i] = queueSlot(m_Encoders[node.EncoderOffset].WorkloadType);
+            m_ExitQueueSlots[i] = queueSlot(m_Encoders[node.EncoderOffset + node.EncoderCount - 1].WorkloadType);
+        }
+
+        // Critical path priorities only matter when compute can overlap graphics on its own queue, and
+        // synchronous graphs execute every submission in sequence regardless
+        bool asyncCompute = Context::Queues().QueueIndex(GPUWorkloadType::Compute) != Context::Queues().QueueIndex(GPUWorkloadType::Graphics);
+        bool prioritize = asyncCompute && Context::Devices().SupportsTimelines();
+
+        // Measured times from earlier frames are preferred over hints. Nodes with neither are assumed to
+        // cost as much as the average known node. The measured times are kept to tell when to reschedule
+        d64 knownCost = 0;
+        u32 knownCount = 0;
+        m_SchedulePrioritized = prioritize;
+        m_NodePriorities.assign(nodeCount, 0);
+        m_AsyncComputeNodes.assign(nodeCount, 0);
+        m_ScheduledCosts.assign(nodeCount, 0);
+        m_NodeCosts.assign(nodeCount, 0);
+        for (u32 i = 0; i < nodeCount && prioritize; i++)
+        {
+            auto& node = m_Nodes[i];
+            if (node.Culled)
+                continue;
+
+            d64 cost = GetNodeGpuTime(node);
+            m_ScheduledCosts[i] = cost;
+            bool allCompute = node.EncoderCount > 0;
+            for (u32 encoderIndex = 0; encoderIndex < node.EncoderCount; encoderIndex++)
+                allCompute &= m_Encoders[node.EncoderOffset + encoderIndex].WorkloadType == GPUWorkloadType::Compute;
+            if (cost <= 0)
+                cost = node.EstimatedCost;
+            if (cost > 0)
+            {
+                knownCost += cost;
+                knownCount++;
+            }
+
+            m_NodePriorities[i] = cost;
+            m_AsyncComputeNodes[i] = allCompute;
+        }
+        d64 defaultCost = knownCount > 0 ? knownCost / knownCount : 1;
+
+        // Priority is the longest path to the end of the graph. The current order is valid for every
+        // constraint, so walking it backwards finalizes successors first
+        for (u32 i = orderCount; i > 0 && prioritize; i--)
+        {
+            u32 nodeIndex = order[i - 1];
+            d64 longestSuccessor = 0;
+            for (u32 j = m_SuccessorOffsets[nodeIndex]; j < m_SuccessorOffsets[nodeIndex + 1]; j++)
+                longestSuccessor = std::max(longestSuccessor, m_NodePriorities[m_Successors[j]]);
+            d64 cost = m_NodePriorities[nodeIndex] > 0 ? m_NodePriorities[nodeIndex] : defaultCost;
+            m_NodeCosts[nodeIndex] = cost;
+            m_NodePriorities[nodeIndex] = cost + longestSuccessor;
+        }
+        d64 overlapBefore = prioritize ? EstimateAsyncComputeOverlap() : 0;
+
+        m_OrderPositions.resize(nodeCount);
+        for (u32 i = 0; i < orderCount; i++)
+            m_OrderPositions[order[i]] = i;
+
+        // List schedule over the constraints. Nodes that continue on the queue of the last scheduled node are
+        // taken first so that they share its submission, and only once that queue runs dry does the schedule
+        // switch. When switching, ready async compute nodes go first so that they run alongside the graphics
+        // work submitted after them, then nodes on the longest path. Ties keep the current order so that
+        // schedules are stable between builds. An async compute node only overlaps the graphics work left
+        // after it, so one that is nearly as critical as the run it would wait behind breaks that run at the
+        // cost of an extra submission
+        const auto lowerPriority = [this](u32 a, u32 b)
+        {
+            if (m_AsyncComputeNodes[a] != m_AsyncComputeNodes[b])
+                return m_AsyncComputeNodes[a] < m_AsyncComputeNodes[b];
+            if (m_NodePriorities[a] != m_NodePriorities[b])
+                return m_NodePriorities[a] < m_NodePriorities[b];
+            return m_OrderPositions[a] > m_OrderPositions[b];
+        };
+        const auto pushReady = [this, &lowerPriority](u32 nodeIndex)
+        {
+            auto& ready = m_ReadyNodes[m_EntryQueueSlots[nodeIndex]];
+            ready.emplace_back(nodeIndex);
+            std::push_heap(ready.begin(), ready.end(), lowerPriority);
+        };
+
+        m_DependentCounts.assign(nodeCount, 0);
+        for (u32 successor : m_Successors)
+            m_DependentCounts[successor]++;
+
+        for (auto& ready : m_ReadyNodes)
+            ready.clear();
+        for (u32 i = 0; i < nodeCount; i++)
+            if (m_DependentCounts[i] == 0 && !m_Nodes[i].Culled)
+                pushReady(i);
+
+        order.clear();
+        u32 currentSlot = EncoderlessQueueSlot;
+        while (order.size() < orderCount)
+        {
+            u32 slot = EncoderlessQueueSlot;
+            if (m_ReadyNodes[slot].empty())
+            {
+                slot = currentSlot;
+                if (slot != EncoderlessQueueSlot && !m_ReadyNodes[slot].empty())
+                {
+                    u32 runNode = m_ReadyNodes[slot].front();
+                    for (u32 candidate = 0; candidate < EncoderlessQueueSlot && !m_AsyncComputeNodes[runNode]; candidate++)
+                    {
+                        if (candidate == currentSlot || m_ReadyNodes[candidate].empty())
+                            continue;
+                        u32 node = m_ReadyNodes[candidate].front();
+                        if (m_AsyncComputeNodes[node] && m_NodePriorities[node] >= m_NodePriorities[runNode] * AsyncComputeBreakRatio)
+                        {
+                            slot = candidate;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    slot = EncoderlessQueueSlot;
+                    for (u32 candidate = 0; candidate < EncoderlessQueueSlot; candidate++)
+                    {
+                        if (m_ReadyNodes[candidate].empty())
+                            continue;
+                        if (slot == EncoderlessQueueSlot || lowerPriority(m_ReadyNodes[slot].front(), m_ReadyNodes[candidate].front()))
+                            slot = candidate;
+                    }
+                }
+            }
+
+            auto& ready = m_ReadyNodes[slot];
+            std::pop_heap(ready.begin(), ready.end(), lowerPriority);
+            u32 nodeIndex = ready.back();
+            ready.pop_back();
+            order.emplace_back(nodeIndex);
+            if (m_ExitQueueSlots[nodeIndex] != EncoderlessQueueSlot)
+                currentSlot = m_ExitQueueSlots[nodeIndex];
+
+            for (u32 j = m_SuccessorOffsets[nodeIndex]; j < m_SuccessorOffsets[nodeIndex + 1]; j++)
+            {
+                u32 successor = m_Successors[j];
+                if (--m_DependentCounts[successor] == 0)
+                    pushReady(successor);
+            }
+        }
+
+        // Logged together so that grouping submissions can be weighed against the overlap it gives up
+        FL_LOG_DEBUG(
+            "RenderGraph scheduled %d nodes into %d submissions (%d before reordering) with %.3fms of async compute overlap (%.3fms before)",
+            orderCount, CountSubmissions(), submissionsBefore,
+            prioritize ? EstimateAsyncComputeOverlap() / 1000000.0 : 0.0, overlapBefore / 1000000.0
+        );
+    }
+
+    d64 RenderGraph::EstimateAsyncComputeOverlap()
+    {
+        // Rough upper bound assuming every async compute node can run alongside all graphics work ordered
+        // after it. Uses the costs from the last schedule
+        d64 remainingGraphics = 0;
+        for (u32 nodeIndex : m_ExecuteData.SubmissionOrder)
+            if (!m_AsyncComputeNodes[nodeIndex] && m_Nodes[nodeIndex].EncoderCount > 0)
+                remainingGraphics += m_NodeCosts[nodeIndex];
+
+        d64 overlap = 0;
+        for (u32 nodeIndex : m_ExecuteData.SubmissionOrder)
+        {
+            if (m_AsyncComputeNodes[nodeIndex])
+                overlap += std::min(m_NodeCosts[nodeIndex], remainingGraphics);
+            else if (m_Nodes[nodeIndex].EncoderCount > 0)
+                remainingGraphics -= m_NodeCosts[nodeIndex];
+        }
+
+        return overlap;
+    }
+
+    u32 RenderGraph::CountSubmissions()
+    {
+        // Mirrors the build, which starts a new submission whenever consecutive encoders change queues
+        u32 count = 0;
+        u32 currentQueue = 0;
+        for (u32 nodeIndex : m_ExecuteData.SubmissionOrder)
+        {
+            auto& node = m_Nodes[nodeIndex];
+            for (u32 encoderIndex = node.EncoderOffset; encoderIndex < node.EncoderOffset + node.EncoderCount; encoderIndex++)
+            {
+                u32 queueIndex = Context::Queues().QueueIndex(m_Encoders[encoderIndex].WorkloadType);
+                if (count == 0 || queueIndex != currentQueue)
+                    count++;
+                currentQueue = queueIndex;
+            }
+        }
+
+        return count;
+    }
+
+    void RenderGraph::PlaceTransientResources()
+    {
+        if (m_Transients.empty())
+            return;
+
+        for (u32 i = 0; i < m_Transients.size(); i++)
+        {
+            auto& transient = m_Transients[i];
+            transient.HeapIndex = -1;
+            transient.FirstUse = -1;
+            transient.LastUse = -1;
+            transient.LastUseWorkloadIndices.fill(-1);
+            transient.LastUseStages.fill(0);
+            transient.LastUseAccess.fill(0);
+
+            auto found = std::lower_bound(m_ResourceIds.begin(), m_ResourceIds.end(), transient.ResourceId);
+            if (found != m_ResourceIds.end() && *found == transient.ResourceId)
+                m_AllResources[found - m_ResourceIds.begin()].TransientIndex = static_cast<int>(i);
+        }
+
+        // Lifetimes span from the first to the last encoder that references the resource
+        int totalIndex = 0;
+        for (u32 nodeIndex : m_ExecuteData.SubmissionOrder)
+        {
+            auto& node = m_Nodes[nodeIndex];
+            for (u32 subIndex = 0; subIndex < node.EncoderCount; subIndex++)
+            {
+                auto& encoder = m_Encoders[node.EncoderOffset + subIndex];
+                for (u32 usageIndex = encoder.UsageOffset; usageIndex < encoder.UsageOffset + encoder.UsageCount; usageIndex++)
+                {
+                    int transientIndex = m_AllResources[m_UsageResourceIndices[usageIndex]].TransientIndex;
+                    if (transientIndex == -1)
+                        continue;
+
+                    auto& transient = m_Transients[transientIndex];
+                    if (transient.FirstUse == -1)
+                        transient.FirstUse = totalIndex;
+                    transient.LastUse = totalIndex;
+                }
+                totalIndex++;
+            }
+        }
+
+        m_TransientOrder.clear();
+        for (u32 i = 0; i < m_Transients.size(); i++)
+            if (m_Transients[i].FirstUse != -1)
+                m_TransientOrder.emplace_back(i);
+        std::stable_sort(m_TransientOrder.begin(), m_TransientOrder.end(), [this](u32 a, u32 b)
+        {
+            return m_Transients[a].Requirements.size > m_Transients[b].Requirements.size;
+        });
+
+        // Largest resources are placed first, each at the lowest offset that does not overlap a placed resource
+        // whose lifetime overlaps its own. Buffers and images never share a heap so that placements do not need
+        // to account for bufferImageGranularity
+        m_PlacedHeaps.clear();
+        for (u32 orderIndex = 0; orderIndex < m_TransientOrder.size(); orderIndex++)
+        {
+            auto& transient = m_Transients[m_TransientOrder[orderIndex]];
+            auto& requirements = transient.Requirements;
+
+            u32 heapIndex = 0;
+            for (; heapIndex < m_PlacedHeaps.size(); heapIndex++)
+            {
+                auto& heap = m_PlacedHeaps[heapIndex];
+                if (heap.ResourceType == transient.ResourceType && (heap.MemoryTypeBits & requirements.memoryTypeBits))
+                    break;
+            }
+            if (heapIndex == m_PlacedHeaps.size())
+            {
+                auto& heap = m_PlacedHeaps.emplace_back();
+                heap.ResourceType = transient.ResourceType;
+                heap.MemoryTypeBits = requirements.memoryTypeBits;
+            }
+
+            m_PlacedRanges.clear();
+            for (u32 i = 0; i < orderIndex; i++)
+            {
+                auto& placed = m_Transients[m_TransientOrder[i]];
+                if (placed.HeapIndex == static_cast<int>(heapIndex) &&
+                    placed.FirstUse <= transient.LastUse && transient.FirstUse <= placed.LastUse)
+                    m_PlacedRanges.emplace_back(placed.Offset, placed.Offset + placed.Requirements.size);
+            }
+            std::sort(m_PlacedRanges.begin(), m_PlacedRanges.end());
+
+            VkDeviceSize offset = 0;
+            for (auto& range : m_PlacedRanges)
+            {
+                if (offset + requirements.size <= range.first)
+                    break;
+                VkDeviceSize alignedEnd = (range.second + requirements.alignment - 1) & ~(requirements.alignment - 1);
+                offset = std::max(offset, alignedEnd);
+            }
+
+            auto& heap = m_PlacedHeaps[heapIndex];
+            heap.Size = std::max(heap.Size, offset + requirements.size);
+            heap.Alignment = std::max(heap.Alignment, requirements.alignment);
+            heap.MemoryTypeBits &= requirements.memoryTypeBits;
+            transient.HeapIndex = static_cast<int>(heapIndex);
+            transient.Offset = offset;
+        }
+
+        UpdateTransientHeaps();
+    }
+
+    void RenderGraph::UpdateTransientHeaps()
+    {
+        // Existing allocations are kept as long as they can still hold the new placement
+        for (u32 i = 0; i < m_PlacedHeaps.size(); i++)
+        {
+            auto& placed = m_PlacedHeaps[i];
+            if (i < m_TransientHeaps.size())
+            {
+                auto& existing = m_TransientHeaps[i];
+                VmaAllocationInfo allocInfo;
+                vmaGetAllocationInfo(Context::Allocator(), existing.Allocation, &allocInfo);
+                bool compatible = existing.ResourceType == placed.ResourceType &&
+                    existing.Size >= placed.Size &&
+                    existing.Alignment >= placed.Alignment &&
+                    (placed.MemoryTypeBits & (1 << allocInfo.memoryType));
+                if (compatible)
+                {
+                    placed = existing;
+                    existing.Allocation = VK_NULL_HANDLE;
+                    continue;
+                }
+            }
+
+            VkMemoryRequirements requirements{ placed.Size, placed.Alignment, placed.MemoryTypeBits };
+            VmaAllocationCreateInfo allocCreateInfo{};
+            allocCreateInfo.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            if (!FL_VK_CHECK_RESULT(vmaAllocateMemory(
+                Context::Allocator(),
+                &requirements,
+                &allocCreateInfo,
+                &placed.Allocation,
+                nullptr
+            ), "RenderGraph allocate transient memory"))
+                throw std::exception();
+
+            Context::MemoryTracker().Track(placed.Allocation, MemoryCategory::Transient, "RenderGraph transients");
+        }
+
+        for (auto& heap : m_TransientHeaps)
+        {
+            if (!heap.Allocation)
+                continue;
+
+            // Resources still bound to the freed memory must be rebound before their next use
+            for (auto& transient : m_Transients)
+                if (transient.BoundAllocation == heap.Allocation)
+                    transient.BoundAllocation = VK_NULL_HANDLE;
+
+            VmaAllocation allocation = heap.Allocation;
+            Context::FinalizerQueue().Push([allocation]()
+            {
+                Context::MemoryTracker().Untrack(allocation);
+                vmaFreeMemory(Context::Allocator(), allocation);
+            }, "RenderGraph transient heap free");
+        }
+        m_TransientHeaps.swap(m_PlacedHeaps);
+
+        u32 reboundCount = 0;
+        for (u32 transientIndex : m_TransientOrder)
+        {
+            auto& transient = m_Transients[transientIndex];
+            VmaAllocation allocation = m_TransientHeaps[transient.HeapIndex].Allocation;
+            if (transient.BoundAllocation == allocation && transient.BoundOffset == transient.Offset)
+                continue;
+
+            if (transient.ResourceType == RenderGraphResourceType::Texture)
+                static_cast<Texture*>(transient.Texture.get())->BindTransientMemory(allocation, transient.Offset);
+            else
+                static_cast<Buffer*>(transient.Buffer.get())->BindTransientMemory(allocation, transient.Offset);
+
+            transient.BoundAllocation = allocation;
+            transient.BoundOffset = transient.Offset;
+            reboundCount++;
+        }
+
+        if (reboundCount > 0)
+            FL_LOG_DEBUG("RenderGraph placed %d transient resources into %d heaps", reboundCount, static_cast<u32>(m_TransientHeaps.size()));
+    }
+
+    void RenderGraph::PopulateFrameResources()
+    {
+        FL_PROFILE_FUNCTION();
+
+        m_FrameResourceOrder.clear();
+        for (u32 i = 0; i < m_AllResources.size(); i++)
+            if (m_AllResources[i].FirstUseSubmitIndex != -1)
+                m_FrameResourceOrder.emplace_back(i);
+        std::sort(m_FrameResourceOrder.begin(), m_FrameResourceOrder.end(), [this](u32 a, u32 b)
+        {
+            int firstA = m_AllResources[a].FirstUseSubmitIndex;
+            int firstB = m_AllResources[b].FirstUseSubmitIndex;
+            return firstA == firstB ? a < b : firstA < firstB;
+        });
+
+        // Position of each compact resource in FrameResources
+        std::vector<u32> frameResourceIndices(m_AllResources.size());
+        m_ExecuteData.FrameResources.reserve(m_FrameResourceOrder.size());
+        for (u32 resourceIndex : m_FrameResourceOrder)
+        {
+            auto& resourceInfo = m_AllResources[resourceIndex];
+            auto& submitData = m_ExecuteData.SubmitData[resourceInfo.FirstUseSubmitIndex];
+            if (submitData.FrameResourceCount == 0)
+                submitData.FrameResourceOffset = m_ExecuteData.FrameResources.size();
+            submitData.FrameResourceCount++;
+
+            frameResourceIndices[resourceIndex] = m_ExecuteData.FrameResources.size();
+            auto& frameResource = m_ExecuteData.FrameResources.emplace_back();
+            frameResource.ResourceId = m_ResourceIds[resourceIndex];
+            frameResource.Access = resourceInfo.FrameAccess;
+            if (resourceInfo.LastWriteIndex != -1)
+                frameResource.LastWriteSubmitIndex = m_ExecuteData.SubmissionSyncs[resourceInfo.LastWriteWorkloadIndex].SubmitDataIndex;
+        }
+
+        // Keep the reads that happen after the last write outside of its submission, which the last
+        // write does not already cover, keyed by frame resource instead of compact index
+        u32 readCount = 0;
+        for (u32 i = 0; i < m_FrameReadUses.size(); i++)
+        {
+            auto [resourceIndex, submitIndex] = m_FrameReadUses[i];
+            u32 frameResourceIndex = frameResourceIndices[resourceIndex];
+            if (i < m_AllResources[resourceIndex].FrameReadStart ||
+                submitIndex == m_ExecuteData.FrameResources[frameResourceIndex].LastWriteSubmitIndex)
+                continue;
+            m_FrameReadUses[readCount++] = { frameResourceIndex, submitIndex };
+        }
+        m_FrameReadUses.resize(readCount);
+        std::sort(m_FrameReadUses.begin(), m_FrameReadUses.end());
+        m_FrameReadUses.erase(std::unique(m_FrameReadUses.begin(), m_FrameReadUses.end()), m_FrameReadUses.end());
+
+        m_ExecuteData.FrameResourceReads.reserve(m_FrameReadUses.size());
+        for (auto [frameResourceIndex, submitIndex] : m_FrameReadUses)
+        {
+            auto& frameResource = m_ExecuteData.FrameResources[frameResourceIndex];
+            if (frameResource.ReadCount == 0)
+                frameResource.ReadOffset = m_ExecuteData.FrameResourceReads.size();
+            frameResource.ReadCount++;
+            m_ExecuteData.FrameResourceReads.emplace_back(submitIndex);
+        }
+
+        // Transient memory may be aliased with whatever the previous frame placed there, which is only
+        // ordered when the whole frame is waited on
+        bool usesTransients = std::any_of(m_Transients.begin(), m_Transients.end(), [](const TransientResource& transient)
+        {
+            return transient.FirstUse != -1;
+        });
+        m_ExecuteData.ConservativeFrameSync = usesTransients;
     }
 
     VkPipelineStageFlags RenderGraph::GetWorkloadStageFlags(GPUWorkloadType type)
@@ -372,52 +1431,273 @@ namespace Flourish::Vulkan
         }
     }
 
-    void RenderGraph::PopulateSubmissionBarrier(SubmissionBarrier& barrier, GPUWorkloadType srcWorkload, GPUWorkloadType dstWorkload)
+    VkPipelineStageFlags2KHR RenderGraph::GetShaderStageFlags(ShaderType stages, GPUWorkloadType workload)
+    {
+        VkPipelineStageFlags2KHR flags = 0;
+        if (workload == GPUWorkloadType::Graphics)
+        {
+            if (stages & ShaderTypeFlags::Vertex)
+                flags |= VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT_KHR;
+            if (stages & ShaderTypeFlags::Fragment)
+                flags |= VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
+            if (!flags)
+                flags = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT_KHR | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
+            return flags;
+        }
+
+        const ShaderType rayStages = ShaderTypeFlags::RayGen | ShaderTypeFlags::RayMiss |
+            ShaderTypeFlags::RayIntersection | ShaderTypeFlags::RayClosestHit | ShaderTypeFlags::RayAnyHit;
+        if (stages & ShaderTypeFlags::Compute)
+            flags |= VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR;
+        if ((stages & rayStages) && Flourish::Context::FeatureTable().RayTracing)
+            flags |= VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR;
+        if (!flags)
+            flags = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR;
+        return flags;
+    }
+
+    void RenderGraph::GetUsageFlags(
+        const RenderGraphResourceUsage& usage,
+        GPUWorkloadType workload,
+        bool write,
+        VkPipelineStageFlags2KHR& stages,
+        VkAccessFlags2KHR& access)
     {
-        const SubmissionBarrier& computeBarrier = Flourish::Context::FeatureTable().RayTracing
-            ? COMPUTE_BARRIER_RT
-            : COMPUTE_BARRIER;
+        auto type = usage.AccessType;
 
-        switch (dstWorkload)
+        // Transfer encoders only ever touch resources through copies and blits
+        if (workload == GPUWorkloadType::Transfer && type != RenderGraphResourceAccessType::Generic)
+            type = RenderGraphResourceAccessType::Transfer;
+
+        // Fixed function graphics accesses do not exist outside of graphics encoders
+        bool graphicsOnly = type == RenderGraphResourceAccessType::ColorAttachment ||
+            type == RenderGraphResourceAccessType::DepthAttachment ||
+            type == RenderGraphResourceAccessType::VertexBuffer ||
+            type == RenderGraphResourceAccessType::IndexBuffer;
+        if (graphicsOnly && workload != GPUWorkloadType::Graphics)
+            type = RenderGraphResourceAccessType::Generic;
+
+        // Synchronization2 masks are used regardless of support since the finer stages and accesses
+        // map back onto their legacy equivalents when recorded
+        switch (type)
         {
-            case GPUWorkloadType::Graphics:
+            case RenderGraphResourceAccessType::Generic:
             {
-                if (!barrier.ShouldBarrier)
-                    barrier = GRAPHICS_BARRIER;
-                barrier.MemoryBarrier.dstAccessMask |= VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                stages = GetWorkloadStageFlags(workload);
+                if (workload == GPUWorkloadType::Compute && Flourish::Context::FeatureTable().RayTracing)
+                    stages |= VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR | VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR;
+                access = write ? VK_ACCESS_2_MEMORY_WRITE_BIT_KHR : VK_ACCESS_2_MEMORY_READ_BIT_KHR;
             } break;
-            case GPUWorkloadType::Compute:
+            case RenderGraphResourceAccessType::Sampled:
             {
-                if (!barrier.ShouldBarrier)
-                    barrier = computeBarrier;
-                barrier.MemoryBarrier.dstAccessMask |= VK_ACCESS_MEMORY_WRITE_BIT;
+                stages = GetShaderStageFlags(usage.Stages, workload);
+                access = write ? VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR : VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR;
             } break;
-            case GPUWorkloadType::Transfer:
+            case RenderGraphResourceAccessType::Storage:
             {
-                if (!barrier.ShouldBarrier)
-                    barrier = TRANSFER_BARRIER;
-                barrier.MemoryBarrier.dstAccessMask |= VK_ACCESS_TRANSFER_WRITE_BIT;
+                stages = GetShaderStageFlags(usage.Stages, workload);
+                access = write ? VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR : VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR;
             } break;
-        }
-
-        switch (srcWorkload)
-        {
-            case GPUWorkloadType::Graphics:
+            case RenderGraphResourceAccessType::Uniform:
+            {
+                stages = GetShaderStageFlags(usage.Stages, workload);
+                access = write ? VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR : VK_ACCESS_2_UNIFORM_READ_BIT_KHR;
+            } break;
+            case RenderGraphResourceAccessType::ColorAttachment:
             {
-                barrier.SrcStage = GRAPHICS_BARRIER.SrcStage;
-                barrier.MemoryBarrier.srcAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                stages = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR;
+                access = write ? VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR : VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT_KHR;
             } break;
-            case GPUWorkloadType::Compute:
+            case RenderGraphResourceAccessType::DepthAttachment:
             {
-                barrier.SrcStage = computeBarrier.SrcStage;
-                barrier.MemoryBarrier.srcAccessMask |= VK_ACCESS_MEMORY_WRITE_BIT;
+                stages = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR;
+                access = write ? VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR : VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT_KHR;
             } break;
-            case GPUWorkloadType::Transfer:
+            case RenderGraphResourceAccessType::VertexBuffer:
             {
-                barrier.SrcStage = TRANSFER_BARRIER.SrcStage;
-                barrier.MemoryBarrier.srcAccessMask |= VK_ACCESS_TRANSFER_WRITE_BIT;
+                stages = VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT_KHR;
+                access = write ? VK_ACCESS_2_MEMORY_WRITE_BIT_KHR : VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT_KHR;
             } break;
+            case RenderGraphResourceAccessType::IndexBuffer:
+            {
+                stages = VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT_KHR;
+                access = write ? VK_ACCESS_2_MEMORY_WRITE_BIT_KHR : VK_ACCESS_2_INDEX_READ_BIT_KHR;
+            } break;
+            case RenderGraphResourceAccessType::Indirect:
+            {
+                stages = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT_KHR;
+                access = write ? VK_ACCESS_2_MEMORY_WRITE_BIT_KHR : VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT_KHR;
+            } break;
+            case RenderGraphResourceAccessType::Transfer:
+            {
+                stages = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR;
+                access = write ? VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR : VK_ACCESS_2_TRANSFER_READ_BIT_KHR;
+            } break;
+        }
+    }
+
+    void RenderGraph::AddResourceBarrier(
+        SubmissionBarrier& barrier,
+        const RenderGraphResourceUsage& usage,
+        VkPipelineStageFlags2KHR srcStages,
+        VkAccessFlags2KHR srcAccess,
+        VkPipelineStageFlags2KHR dstStages,
+        VkAccessFlags2KHR dstAccess)
+    {
+        barrier.ShouldBarrier = true;
+
+        // Generic usages do not say how the resource is accessed, so fall back to a global memory barrier
+        if (usage.AccessType == RenderGraphResourceAccessType::Generic || !usage.Resource)
+        {
+            barrier.MemoryBarrier.srcStageMask |= srcStages;
+            barrier.MemoryBarrier.srcAccessMask |= srcAccess;
+            barrier.MemoryBarrier.dstStageMask |= dstStages;
+            barrier.MemoryBarrier.dstAccessMask |= dstAccess;
+            return;
+        }
+
+        // Every barrier for a submission is added while processing it, so its range is always at the end
+        auto& barriers = m_ExecuteData.ResourceBarriers;
+        if (barrier.ResourceBarrierCount == 0)
+            barrier.ResourceBarrierOffset = static_cast<u32>(barriers.size());
+        for (u32 i = barrier.ResourceBarrierOffset; i < barriers.size(); i++)
+        {
+            if (barriers[i].Resource == usage.Resource)
+            {
+                barriers[i].SrcStages |= srcStages;
+                barriers[i].SrcAccess |= srcAccess;
+                barriers[i].DstStages |= dstStages;
+                barriers[i].DstAccess |= dstAccess;
+                return;
+            }
         }
+
+        barriers.push_back({ usage.Resource, usage.ResourceType, srcStages, srcAccess, dstStages, dstAccess });
+        barrier.ResourceBarrierCount++;
+    }
+
+    void RenderGraph::AddWriteBarrier(
+        SubmissionBarrier& barrier,
+        const ResourceSyncInfo& resourceInfo,
+        u32 usageIndex,
+        u32 encoderIndex,
+        int workloadIndex,
+        VkPipelineStageFlags2KHR dstStages,
+        VkAccessFlags2KHR dstAccess)
+    {
+        // When other encoders are recorded between the last write and this access in the same command buffer, the
+        // dependency is split with an event so that they can overlap with the write instead of waiting behind it
+        bool split = resourceInfo.LastWriteWorkloadIndex == workloadIndex &&
+                     static_cast<int>(encoderIndex) > resourceInfo.LastWriteIndex + 1;
+        if (!split)
+        {
+            AddResourceBarrier(
+                barrier, m_ResourceUsages[usageIndex],
+                resourceInfo.LastWriteStages, resourceInfo.LastWriteAccess,
+                dstStages, dstAccess
+            );
+            return;
+        }
+
+        m_PendingSplits.push_back({
+            static_cast<u32>(resourceInfo.LastWriteIndex), usageIndex,
+            resourceInfo.LastWriteStages, resourceInfo.LastWriteAccess,
+            dstStages, dstAccess
+        });
+    }
+
+    void RenderGraph::AddSplitBarriers(SubmissionSyncInfo& sync)
+    {
+        // One event per producing encoder, which covers every resource it wrote
+        std::stable_sort(m_PendingSplits.begin(), m_PendingSplits.end(), [](const PendingSplitBarrier& a, const PendingSplitBarrier& b)
+        {
+            return a.SetIndex < b.SetIndex;
+        });
+
+        sync.SplitWaitOffset = static_cast<u32>(m_ExecuteData.SplitBarriers.size());
+        for (u32 i = 0; i < m_PendingSplits.size(); i++)
+        {
+            auto& pending = m_PendingSplits[i];
+            if (i == 0 || pending.SetIndex != m_PendingSplits[i - 1].SetIndex)
+            {
+                auto& split = m_ExecuteData.SplitBarriers.emplace_back();
+                split.SetIndex = pending.SetIndex;
+                for (u32 j = 0; j < m_SyncObjectCount; j++)
+                    split.Events[j] = GetEvent();
+                sync.SplitWaitCount++;
+            }
+
+            AddResourceBarrier(
+                m_ExecuteData.SplitBarriers.back().Barrier, m_ResourceUsages[pending.UsageIndex],
+                pending.SrcStages, pending.SrcAccess,
+                pending.DstStages, pending.DstAccess
+            );
+        }
+
+        m_PendingSplits.clear();
+    }
+
+    void RenderGraph::AddAliasingBarrier(
+        SubmissionBarrier& barrier,
+        const RenderGraphResourceUsage& usage,
+        u32 transientIndex,
+        int submitIndex,
+        u32 queueIndex,
+        bool synchronous,
+        VkPipelineStageFlags2KHR dstStages,
+        VkAccessFlags2KHR dstAccess)
+    {
+        auto& transient = m_Transients[transientIndex];
+
+        // Transients that overlap in memory never overlap in lifetime, so every earlier one that overlaps has
+        // already recorded all of its uses
+        VkPipelineStageFlags2KHR srcStages = 0;
+        VkAccessFlags2KHR srcAccess = 0;
+        for (auto& other : m_Transients)
+        {
+            if (other.HeapIndex != transient.HeapIndex || other.FirstUse == -1 || other.LastUse >= transient.FirstUse)
+                continue;
+            if (other.Offset >= transient.Offset + transient.Requirements.size ||
+                transient.Offset >= other.Offset + other.Requirements.size)
+                continue;
+
+            for (u32 workload = 0; workload < other.LastUseWorkloadIndices.size(); workload++)
+            {
+                int workloadIndex = other.LastUseWorkloadIndices[workload];
+                if (workloadIndex == -1)
+                    continue;
+
+                if (Context::Queues().QueueIndex(static_cast<GPUWorkloadType>(workload)) == queueIndex)
+                {
+                    srcStages |= other.LastUseStages[workload];
+                    srcAccess |= other.LastUseAccess[workload];
+                }
+                else if (!synchronous)
+                    AddSubmissionDependency(m_ExecuteData.SubmissionSyncs[workloadIndex].SubmitDataIndex, submitIndex);
+            }
+        }
+
+        // Always barriers on the resource itself, even for generic usages, since images need to leave the
+        // undefined layout
+        barrier.ShouldBarrier = true;
+        auto& barriers = m_ExecuteData.ResourceBarriers;
+        if (barrier.ResourceBarrierCount == 0)
+            barrier.ResourceBarrierOffset = static_cast<u32>(barriers.size());
+        for (u32 i = barrier.ResourceBarrierOffset; i < barriers.size(); i++)
+        {
+            if (barriers[i].Resource == usage.Resource)
+            {
+                barriers[i].SrcStages |= srcStages;
+                barriers[i].SrcAccess |= srcAccess;
+                barriers[i].DstStages |= dstStages;
+                barriers[i].DstAccess |= dstAccess;
+                barriers[i].Discard = true;
+                return;
+            }
+        }
+
+        barriers.push_back({ usage.Resource, usage.ResourceType, srcStages, srcAccess, dstStages, dstAccess, true });
+        barrier.ResourceBarrierCount++;
     }
 
     VkSemaphore RenderGraph::GetSemaphore()
@@ -438,4 +1718,248 @@ namespace Flourish::Vulkan
             m_AllFences.emplace_back(Synchronization::CreateFence());
         return m_AllFences[m_FreeFenceIndex++];
     }
+
+    VkEvent RenderGraph::GetEvent()
+    {
+        if (m_FreeEventIndex >= m_AllEvents.size())
+            m_AllEvents.emplace_back(Synchronization::CreateEvent());
+        return m_AllEvents[m_FreeEventIndex++];
+    }
+
+    std::string RenderGraph::ExportDot(const std::vector<int>& encoderSubmits, bool includeTimings) const
+    {
+        std::string out = "digraph RenderGraph\n{\n    rankdir=LR;\n    node [shape=box, fontname=\"monospace\"];\n";
+        auto& order = m_ExecuteData.SubmissionOrder;
+
+        // First and last encoder recorded into each submission, used as the endpoints of wait edges
+        std::vector<std::pair<int, int>> submitEncoders(m_ExecuteData.SubmitData.size(), { -1, -1 });
+        for (u32 i = 0; i < encoderSubmits.size(); i++)
+        {
+            auto& range = submitEncoders[encoderSubmits[i]];
+            if (range.first == -1)
+                range.first = i;
+            range.second = i;
+        }
+
+        // Encoders are grouped into one cluster per submission. Global memory barriers are highlighted
+        // since they serialize the whole queue
+        u32 totalIndex = 0;
+        int currentSubmit = -1;
+        for (u32 nodeIndex : order)
+        {
+            auto& node = m_Nodes[nodeIndex];
+            for (u32 encoderIndex = 0; encoderIndex < node.EncoderCount; encoderIndex++)
+            {
+                int submit = encoderSubmits[totalIndex];
+                if (submit != currentSubmit)
+                {
+                    if (currentSubmit != -1)
+                        out += "    }\n";
+                    auto& submitData = m_ExecuteData.SubmitData[submit];
+                    AppendFormat(
+                        out,
+                        "    subgraph cluster_%d\n    {\n        label=\"Submission %d\\n%s (family %u)%s\";\n        style=rounded;\n",
+                        submit, submit,
+                        WorkloadTypeToString(submitData.Workload),
+                        Context::Queues().QueueIndex(submitData.Workload),
+                        submitData.WaitingWorkloads.empty() ? "\\nwaits on previous frame" : ""
+                    );
+                    currentSubmit = submit;
+                }
+
+                auto& encoder = m_Encoders[node.EncoderOffset + encoderIndex];
+                auto& barrier = m_ExecuteData.SubmissionSyncs[totalIndex].Barrier;
+                bool memoryBarrier = barrier.ShouldBarrier && (barrier.MemoryBarrier.srcStageMask || barrier.MemoryBarrier.dstStageMask);
+                AppendFormat(
+                    out,
+                    "        e%u [label=\"Node %llu\\nEncoder %u (%s)",
+                    totalIndex, (unsigned long long)node.Id, encoderIndex, WorkloadTypeToString(encoder.WorkloadType)
+                );
+                if (barrier.ShouldBarrier)
+                    AppendFormat(out, "\\nBarrier: %u resources%s", barrier.ResourceBarrierCount, memoryBarrier ? " + memory" : "");
+                if (includeTimings)
+                {
+                    auto timestamp = GetEncoderTimestamp(node.Id, encoderIndex);
+                    AppendFormat(out, "\\nGPU %.1f us", (timestamp.End - timestamp.Start) / 1000.0);
+                    if (encoderIndex == 0)
+                        AppendFormat(out, "\\nCPU %.1f us", GetNodeRecordTime(node.Id) / 1000.0);
+                }
+                AppendFormat(out, "\"%s];\n", memoryBarrier ? ", color=red" : "");
+
+                // Split barriers wait on an event set after an earlier encoder in the same submission
+                auto& sync = m_ExecuteData.SubmissionSyncs[totalIndex];
+                for (u32 i = sync.SplitWaitOffset; i < sync.SplitWaitOffset + sync.SplitWaitCount; i++)
+                    AppendFormat(out, "        e%u -> e%u [style=dashed, label=\"event\"];\n", m_ExecuteData.SplitBarriers[i].SetIndex, totalIndex);
+
+                totalIndex++;
+            }
+        }
+        if (currentSubmit != -1)
+            out += "    }\n";
+
+        for (u32 nodeIndex = 0; nodeIndex < m_Nodes.size(); nodeIndex++)
+            if (m_Nodes[nodeIndex].Culled)
+                AppendFormat(out, "    c%u [label=\"Node %llu\\nculled\", style=dashed, color=gray];\n", nodeIndex, (unsigned long long)m_Nodes[nodeIndex].Id);
+
+        // Encoders that share a submission execute in order
+        for (u32 i = 1; i < encoderSubmits.size(); i++)
+            if (encoderSubmits[i] == encoderSubmits[i - 1])
+                AppendFormat(out, "    e%u -> e%u [color=gray];\n", i - 1, i);
+
+        // Semaphore waits between submissions, which is where queues serialize
+        for (u32 submit = 0; submit < m_ExecuteData.SubmitData.size(); submit++)
+        {
+            for (int waiting : m_ExecuteData.SubmitData[submit].WaitingWorkloads)
+            {
+                bool crossQueue = m_ExecuteData.SubmitData[waiting].Workload != m_ExecuteData.SubmitData[submit].Workload;
+                AppendFormat(
+                    out,
+                    "    e%d -> e%d [label=\"wait\", penwidth=2%s];\n",
+                    submitEncoders[waiting].second, submitEncoders[submit].first,
+                    crossQueue ? ", color=red" : ""
+                );
+            }
+        }
+
+        out += "}\n";
+        return out;
+    }
+
+    std::string RenderGraph::ExportJson(const std::vector<int>& encoderSubmits, bool includeTimings) const
+    {
+        std::string out = "{\n";
+        auto& order = m_ExecuteData.SubmissionOrder;
+
+        std::vector<int> nodeEncoderStarts(m_Nodes.size(), -1);
+        u32 totalIndex = 0;
+        for (u32 nodeIndex : order)
+        {
+            nodeEncoderStarts[nodeIndex] = totalIndex;
+            totalIndex += m_Nodes[nodeIndex].EncoderCount;
+        }
+
+        AppendFormat(out, "  \"frame\": %llu,\n  \"nodes\": [", (unsigned long long)Flourish::Context::FrameCount());
+        for (u32 nodeIndex = 0; nodeIndex < m_Nodes.size(); nodeIndex++)
+        {
+            auto& node = m_Nodes[nodeIndex];
+            AppendFormat(
+                out,
+                "%s\n    {\n      \"id\": %llu,\n      \"culled\": %s,\n      \"sideEffects\": %s,\n",
+                nodeIndex == 0 ? "" : ",",
+                (unsigned long long)node.Id,
+                node.Culled ? "true" : "false",
+                node.HasSideEffects ? "true" : "false"
+            );
+            if (includeTimings)
+                AppendFormat(out, "      \"gpuTime\": %.1f,\n      \"cpuTime\": %.1f,\n", GetNodeGpuTime(node), GetNodeRecordTime(node.Id));
+
+            out += "      \"dependencies\": [";
+            bool first = true;
+            for (u32 i = m_DependencyOffsets[nodeIndex]; i < m_DependencyOffsets[nodeIndex + 1]; i++)
+            {
+                if (m_NodeDependencies[i] == InvalidNode)
+                    continue;
+                AppendFormat(out, "%s%llu", first ? "" : ", ", (unsigned long long)m_Nodes[m_NodeDependencies[i]].Id);
+                first = false;
+            }
+            out += "],\n      \"encoders\": [";
+
+            for (u32 encoderIndex = 0; encoderIndex < node.EncoderCount; encoderIndex++)
+            {
+                auto& encoder = m_Encoders[node.EncoderOffset + encoderIndex];
+                int encoderTotal = nodeEncoderStarts[nodeIndex] == -1 ? -1 : nodeEncoderStarts[nodeIndex] + encoderIndex;
+                AppendFormat(
+                    out,
+                    "%s\n        {\n          \"workload\": \"%s\",\n          \"queueFamily\": %u,\n          \"submission\": %d",
+                    encoderIndex == 0 ? "" : ",",
+                    WorkloadTypeToString(encoder.WorkloadType),
+                    Context::Queues().QueueIndex(encoder.WorkloadType),
+                    encoderTotal == -1 ? -1 : encoderSubmits[encoderTotal]
+                );
+                if (includeTimings)
+                {
+                    auto timestamp = GetEncoderTimestamp(node.Id, encoderIndex);
+                    AppendFormat(out, ",\n          \"gpuTime\": %.1f", timestamp.End - timestamp.Start);
+                }
+
+                // Barrier recorded before the encoder. Masks use synchronization2 values
+                auto* barrier = encoderTotal == -1 ? nullptr : &m_ExecuteData.SubmissionSyncs[encoderTotal].Barrier;
+                if (barrier && barrier->ShouldBarrier)
+                {
+                    auto& memory = barrier->MemoryBarrier;
+                    AppendFormat(
+                        out,
+                        ",\n          \"barrier\": {\n            \"memory\": { \"srcStages\": \"0x%llx\", \"srcAccess\": \"0x%llx\", \"dstStages\": \"0x%llx\", \"dstAccess\": \"0x%llx\" },\n            \"resources\": [",
+                        (unsigned long long)memory.srcStageMask, (unsigned long long)memory.srcAccessMask,
+                        (unsigned long long)memory.dstStageMask, (unsigned long long)memory.dstAccessMask
+                    );
+                    for (u32 i = 0; i < barrier->ResourceBarrierCount; i++)
+                    {
+                        auto& resource = m_ExecuteData.ResourceBarriers[barrier->ResourceBarrierOffset + i];
+                        bool isBuffer = resource.ResourceType == RenderGraphResourceType::Buffer;
+                        u64 resourceId = isBuffer
+                            ? static_cast<const Flourish::Buffer*>(resource.Resource)->GetId()
+                            : static_cast<const Flourish::Texture*>(resource.Resource)->GetId();
+                        AppendFormat(
+                            out,
+                            "%s\n              { \"id\": %llu, \"type\": \"%s\", \"srcStages\": \"0x%llx\", \"srcAccess\": \"0x%llx\", \"dstStages\": \"0x%llx\", \"dstAccess\": \"0x%llx\", \"discard\": %s }",
+                            i == 0 ? "" : ",",
+                            (unsigned long long)resourceId,
+                            isBuffer ? "Buffer" : "Texture",
+                            (unsigned long long)resource.SrcStages, (unsigned long long)resource.SrcAccess,
+                            (unsigned long long)resource.DstStages, (unsigned long long)resource.DstAccess,
+                            resource.Discard ? "true" : "false"
+                        );
+                    }
+                    out += barrier->ResourceBarrierCount > 0 ? "\n            ]\n          }" : "]\n          }";
+                }
+                out += "\n        }";
+            }
+            out += node.EncoderCount > 0 ? "\n      ]\n    }" : "]\n    }";
+        }
+
+        out += "\n  ],\n  \"order\": [";
+        for (u32 i = 0; i < order.size(); i++)
+            AppendFormat(out, "%s%llu", i == 0 ? "" : ", ", (unsigned long long)m_Nodes[order[i]].Id);
+
+        // Submissions without waits are roots, which wait on the previous frame instead
+        out += "],\n  \"submissions\": [";
+        for (u32 submit = 0; submit < m_ExecuteData.SubmitData.size(); submit++)
+        {
+            auto& submitData = m_ExecuteData.SubmitData[submit];
+            AppendFormat(
+                out,
+                "%s\n    { \"workload\": \"%s\", \"queueFamily\": %u, \"completion\": %s, \"waitsOnPreviousFrame\": %s, \"waits\": [",
+                submit == 0 ? "" : ",",
+                WorkloadTypeToString(submitData.Workload),
+                Context::Queues().QueueIndex(submitData.Workload),
+                submitData.IsCompletion ? "true" : "false",
+                submitData.WaitingWorkloads.empty() ? "true" : "false"
+            );
+            for (u32 i = 0; i < submitData.WaitingWorkloads.size(); i++)
+                AppendFormat(out, "%s%d", i == 0 ? "" : ", ", submitData.WaitingWorkloads[i]);
+            out += "] }";
+        }
+        out += "\n  ]\n}\n";
+
+        return out;
+    }
+
+    d64 RenderGraph::GetNodeGpuTime(const RenderGraphNodeData& node) const
+    {
+        d64 time = 0;
+        for (u32 encoderIndex = 0; encoderIndex < node.EncoderCount; encoderIndex++)
+        {
+            auto timestamp = GetEncoderTimestamp(node.Id, encoderIndex);
+            time += timestamp.End - timestamp.Start;
+        }
+
+        return time;
+    }
+
+    d64 RenderGraph::GetNodeRecordTime(u64 nodeId) const
+    {
+        auto found = m_RecordTimes.find(nodeId);
+        return found == m_RecordTimes.end() ? 0 : found->second;
+    }
 }
@@ -11,6 +11,26 @@ namespace Flourish::Vulkan
         int LastWriteIndex = -1;
         int LastWriteWorkloadIndex = -1;
         GPUWorkloadType LastWriteWorkload;
+        VkPipelineStageFlags2KHR LastWriteStages = 0;
+        VkAccessFlags2KHR LastWriteAccess = 0;
+
+        // Stages and accesses on the writing queue that already wait on the last write
+        VkPipelineStageFlags2KHR SyncedStages = 0;
+        VkAccessFlags2KHR SyncedAccess = 0;
+
+        // Reads since the last write which the next write on the same queue must wait on. PriorReadStages
+        // excludes the reads of the submission at LastReadIndex, which that submission orders itself
+        int LastReadIndex = -1;
+        u32 ReadQueue = 0;
+        VkPipelineStageFlags2KHR ReadStages = 0;
+        VkPipelineStageFlags2KHR PriorReadStages = 0;
+
+        int TransientIndex = -1;
+
+        // How the resource is used by the whole graph, which other frames synchronize against
+        int FirstUseSubmitIndex = -1;
+        RenderGraphResourceAccess FrameAccess = RenderGraphResourceAccessFlags::None;
+        u32 FrameReadStart = 0; // First entry of m_FrameReadUses after the last write
     };
 
     struct SubmissionSubmitInfo
@@ -25,26 +45,95 @@ namespace Flourish::Vulkan
         VkTimelineSemaphoreSubmitInfo TimelineSubmitInfo;
         GPUWorkloadType Workload;
         bool IsCompletion = true;
+
+        // Range into GraphExecuteData::FrameResources of the resources first used by this submission
+        u32 FrameResourceOffset = 0;
+        u32 FrameResourceCount = 0;
+    };
+
+    // A resource used by the graph as seen from other frames. Submissions that first use it must wait on
+    // whichever submissions last accessed it before, and the submissions listed here are what later
+    // frames need to wait on in turn
+    struct FrameResourceAccess
+    {
+        u64 ResourceId;
+        RenderGraphResourceAccess Access;
+        int LastWriteSubmitIndex = -1;
+
+        // Range into GraphExecuteData::FrameResourceReads of the submissions reading after the last write
+        u32 ReadOffset = 0;
+        u32 ReadCount = 0;
     };
 
+    // Resolved into a buffer or image barrier at submission time since resource handles may
+    // change between frames
+    struct SubmissionResourceBarrier
+    {
+        const void* Resource;
+        RenderGraphResourceType ResourceType;
+        VkPipelineStageFlags2KHR SrcStages;
+        VkAccessFlags2KHR SrcAccess;
+        VkPipelineStageFlags2KHR DstStages;
+        VkAccessFlags2KHR DstAccess;
+
+        // Contents are discarded, which transitions images from an undefined layout
+        bool Discard = false;
+    };
+
+    // Masks use synchronization2 values and are converted when recording on devices without it
     struct SubmissionBarrier
     {
         bool ShouldBarrier = false;
-        VkMemoryBarrier MemoryBarrier{};
-        VkPipelineStageFlags SrcStage = 0;
-        VkPipelineStageFlags DstStage = 0;
+
+        // Covers generic resources and execution only dependencies
+        VkMemoryBarrier2KHR MemoryBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR };
+
+        // Range into GraphExecuteData::ResourceBarriers
+        u32 ResourceBarrierOffset = 0;
+        u32 ResourceBarrierCount = 0;
+    };
+
+    // A barrier split into an event set right after the producing encoder and a wait right before the
+    // consuming one, so that the encoders recorded in between do not stall on it
+    struct SubmissionSplitBarrier
+    {
+        SubmissionBarrier Barrier;
+        std::array<VkEvent, Flourish::Context::MaxFrameBufferCount> Events;
+        u32 SetIndex; // Encoder index the event is set after
     };
 
     struct SubmissionSyncInfo
     {
         int SubmitDataIndex = -1;
         SubmissionBarrier Barrier;
+
+        // Range into GraphExecuteData::SplitBarriers waited on before the encoder
+        u32 SplitWaitOffset = 0;
+        u32 SplitWaitCount = 0;
+
+        // Range into GraphExecuteData::SplitBarrierSets set after the encoder
+        u32 SplitSetOffset = 0;
+        u32 SplitSetCount = 0;
+    };
+
+    // A barrier to be split once every usage of the consuming encoder is processed
+    struct PendingSplitBarrier
+    {
+        u32 SetIndex;
+        u32 UsageIndex;
+        VkPipelineStageFlags2KHR SrcStages;
+        VkAccessFlags2KHR SrcAccess;
+        VkPipelineStageFlags2KHR DstStages;
+        VkAccessFlags2KHR DstAccess;
     };
 
     struct GraphExecuteData
     {
-        std::vector<u64> SubmissionOrder;
+        std::vector<u32> SubmissionOrder; // Node indices
         std::vector<SubmissionSyncInfo> SubmissionSyncs;
+        std::vector<SubmissionResourceBarrier> ResourceBarriers;
+        std::vector<SubmissionSplitBarrier> SplitBarriers; // Sorted by waiting encoder
+        std::vector<u32> SplitBarrierSets; // Split barrier indices sorted by setting encoder
         std::vector<SubmissionSubmitInfo> SubmitData;
         std::array<std::vector<VkSemaphore>, Flourish::Context::MaxFrameBufferCount> CompletionSemaphores;
         std::array<std::vector<VkFence>, Flourish::Context::MaxFrameBufferCount> CompletionFences;
@@ -52,6 +141,47 @@ namespace Flourish::Vulkan
         // Will be the same across all semaphores, so just needs to be
         // set to the current frame count each submit
         std::vector<u64> WaitSemaphoreValues;
+
+        // Sorted by the submission that first uses each resource. Only populated when fine grained frame
+        // dependencies are enabled, and even then graphs may still need to wait on the whole previous frame
+        std::vector<FrameResourceAccess> FrameResources;
+        std::vector<int> FrameResourceReads; // Submit indices
+        bool ConservativeFrameSync = true;
+    };
+
+    struct TransientResource
+    {
+        std::shared_ptr<Flourish::Texture> Texture;
+        std::shared_ptr<Flourish::Buffer> Buffer;
+        const void* Resource;
+        u64 ResourceId;
+        RenderGraphResourceType ResourceType;
+        VkMemoryRequirements Requirements;
+
+        // Placement is kept across builds so that resources are only rebound when it changes
+        int HeapIndex = -1;
+        VkDeviceSize Offset = 0;
+        VmaAllocation BoundAllocation = VK_NULL_HANDLE;
+        VkDeviceSize BoundOffset = 0;
+
+        // Lifetime in encoder indices over the submission order, -1 if unused by the current build
+        int FirstUse = -1;
+        int LastUse = -1;
+
+        // Last use on each workload type, used to synchronize resources that later reuse the memory
+        std::array<int, 3> LastUseWorkloadIndices;
+        std::array<VkPipelineStageFlags2KHR, 3> LastUseStages;
+        std::array<VkAccessFlags2KHR, 3> LastUseAccess;
+    };
+
+    // One allocation shared by transients of the same resource type and compatible memory types
+    struct TransientHeap
+    {
+        VmaAllocation Allocation = VK_NULL_HANDLE;
+        RenderGraphResourceType ResourceType;
+        VkDeviceSize Size = 0;
+        VkDeviceSize Alignment = 1;
+        u32 MemoryTypeBits = 0;
     };
 
     class CommandBuffer;
@@ -62,6 +192,9 @@ namespace Flourish::Vulkan
         ~RenderGraph() override;
 
         void Build() override;
+        std::shared_ptr<Flourish::Texture> CreateTransientTexture(const TextureCreateInfo& createInfo) override;
+        std::shared_ptr<Flourish::Buffer> CreateTransientBuffer(const BufferCreateInfo& createInfo) override;
+        std::string Export(RenderGraphExportFormat format, bool includeTimings = true) const override;
 
         void PrepareForSubmission();
 
@@ -71,14 +204,68 @@ namespace Flourish::Vulkan
         // TS
         inline const auto& GetExecutionData() const { return m_ExecuteData; }
 
+        void StoreTimestamp(u64 frame, u64 nodeId, u32 encoderIndex, d64 start, d64 end);
+        void StoreRecordTime(u64 nodeId, d64 nanoseconds);
+
     private:
         void ResetBuildVariables();
+        void RemapResources();
         void PopulateSubmissionOrder();
+        void ReportDependencyCycle();
+        void CullNodes();
+        void ScheduleSubmissionOrder();
+        bool ShouldReschedule();
+        void RetireSyncObjects();
+        u32 CountSubmissions();
+        d64 EstimateAsyncComputeOverlap();
+        void PlaceTransientResources();
+        void PopulateFrameResources();
+        void UpdateTransientHeaps();
         VkPipelineStageFlags GetWorkloadStageFlags(GPUWorkloadType type);
-        void PopulateSubmissionBarrier(SubmissionBarrier& barrier, GPUWorkloadType srcWorkload, GPUWorkloadType dstWorkload);
+        VkPipelineStageFlags2KHR GetShaderStageFlags(ShaderType stages, GPUWorkloadType workload);
+        void GetUsageFlags(
+            const RenderGraphResourceUsage& usage,
+            GPUWorkloadType workload,
+            bool write,
+            VkPipelineStageFlags2KHR& stages,
+            VkAccessFlags2KHR& access
+        );
+        void AddResourceBarrier(
+            SubmissionBarrier& barrier,
+            const RenderGraphResourceUsage& usage,
+            VkPipelineStageFlags2KHR srcStages,
+            VkAccessFlags2KHR srcAccess,
+            VkPipelineStageFlags2KHR dstStages,
+            VkAccessFlags2KHR dstAccess
+        );
+        void AddAliasingBarrier(
+            SubmissionBarrier& barrier,
+            const RenderGraphResourceUsage& usage,
+            u32 transientIndex,
+            int submitIndex,
+            u32 queueIndex,
+            bool synchronous,
+            VkPipelineStageFlags2KHR dstStages,
+            VkAccessFlags2KHR dstAccess
+        );
+        void AddWriteBarrier(
+            SubmissionBarrier& barrier,
+            const ResourceSyncInfo& resourceInfo,
+            u32 usageIndex,
+            u32 encoderIndex,
+            int workloadIndex,
+            VkPipelineStageFlags2KHR dstStages,
+            VkAccessFlags2KHR dstAccess
+        );
+        void AddSplitBarriers(SubmissionSyncInfo& sync);
         void AddSubmissionDependency(int fromSubmitIndex, int toSubmitIndex);
         VkSemaphore GetSemaphore();
         VkFence GetFence();
+        VkEvent GetEvent();
+        std::string ExportDot(const std::vector<int>& encoderSubmits, bool includeTimings) const;
+        std::string ExportJson(const std::vector<int>& encoderSubmits, bool includeTimings) const;
+        d64 GetNodeGpuTime(const RenderGraphNodeData& node) const;
+        d64 GetNodeRecordTime(u64 nodeId) const;
 
     private:
         // Execution data relevant for each submission
@@ -86,17 +273,59 @@ namespace Flourish::Vulkan
         u64 m_CurrentSemaphoreValue = 0;
         u64 m_LastSubmissionFrame = 0;
         u64 m_LastBuildFrame = 0;
+        u64 m_BuiltTopologyHash = 0;
+        bool m_HasBuiltTopology = false;
+        std::vector<TransientResource> m_Transients;
+        std::vector<TransientHeap> m_TransientHeaps;
+        std::vector<u32> m_CulledNodes; // Node indices culled by the last full build
+        std::unordered_map<u64, d64> m_RecordTimes; // CPU nanoseconds per node id
+        u64 m_RecordTimeFrame = 0;
+        std::vector<d64> m_ScheduledCosts; // Measured GPU nanoseconds per node that the last schedule used
+        u64 m_ScheduleCheckFrame = 0;
+        bool m_SchedulePrioritized = false;
+        bool m_ReschedulePending = false;
 
         // Temporary build data to be reset on each build
         u32 m_FreeSemaphoreIndex = 0;
         u32 m_FreeFenceIndex = 0;
+        u32 m_FreeEventIndex = 0;
         std::vector<VkSemaphore> m_AllSemaphores;
         std::vector<VkFence> m_AllFences;
-        std::unordered_map<u32, u32> m_LastWaitWrites;
-        std::unordered_map<u64, ResourceSyncInfo> m_AllResources;
-        std::queue<u64> m_ProcessingNodes;
-        std::unordered_set<u64> m_VisitedNodes;
-        std::vector<u64> m_TemporarySubmissionOrder;
+        std::vector<VkEvent> m_AllEvents;
+        std::vector<PendingSplitBarrier> m_PendingSplits;
+        std::vector<ResourceSyncInfo> m_AllResources; // Indexed by compact resource index
+        std::vector<u64> m_ResourceIds; // Sorted, position is the compact resource index
+        std::vector<u32> m_UsageResourceIndices; // Compact resource index of each graph resource usage
+        std::vector<u32> m_DependencyOffsets; // Per node range into m_NodeDependencies
+        std::vector<u32> m_NodeDependencies; // Resolved node indices, InvalidNode if not in the graph
+        std::vector<u32> m_DependentCounts;
+        std::vector<u8> m_RequiredNodes;
+        std::vector<u8> m_RequiredResources; // Per compact resource index
+        std::vector<std::pair<u32, u32>> m_ScheduleEdges; // Node index, dependent node index
+        std::vector<u32> m_SuccessorOffsets; // Per node range into m_Successors
+        std::vector<u32> m_Successors;
+        std::vector<int> m_ResourceWriters; // Last writing node per compact resource index
+        std::vector<int> m_ResourceReaders; // Head of the reader list per compact resource index
+        std::vector<std::pair<u32, int>> m_ReaderLinks; // Reading node, next link
+        std::vector<d64> m_NodePriorities;
+        std::vector<d64> m_NodeCosts; // Nanoseconds, measured or estimated
+        std::vector<u32> m_OrderPositions;
+        std::vector<u8> m_AsyncComputeNodes;
+        std::vector<u8> m_EntryQueueSlots; // Queue of the first encoder per node
+        std::vector<u8> m_ExitQueueSlots; // Queue of the last encoder per node
+        std::array<std::vector<u32>, 4> m_ReadyNodes; // Ready heap per queue slot
+        std::vector<u32> m_TransientOrder; // Used transients sorted by placement priority
+        std::vector<TransientHeap> m_PlacedHeaps;
+        std::vector<std::pair<VkDeviceSize, VkDeviceSize>> m_PlacedRanges;
+        std::vector<std::pair<u32, int>> m_FrameReadUses; // Compact resource index, submit index
+        std::vector<u32> m_FrameResourceOrder; // Compact resource indices sorted by first use
+
+        static constexpr u32 InvalidNode = std::numeric_limits<u32>::max();
+        static constexpr u32 EncoderlessQueueSlot = 3;
+        static constexpr d64 AsyncComputeBreakRatio = 0.5; // Of the priority of the run being broken
+        static constexpr u32 RescheduleCheckInterval = 60; // Frames
+        static constexpr d64 RescheduleDriftRatio = 0.25;
+        static constexpr d64 RescheduleMinDrift = 100000; // Nanoseconds
 
         u32 m_SyncObjectCount = 1;
     };
@@ -407,6 +407,7 @@ namespace Flourish::Vulkan
             writes.data(),
             0, nullptr
         );
+        Flourish::Context::IncrementFrameCounter(FrameCounter::DescriptorWritesFlushed, writes.size());
 
         // TODO: find a way to reuse these?
         m_CachedData.DescriptorWrites.clear();
@@ -76,6 +76,8 @@ namespace Flourish::Vulkan
 
     std::vector<u32> CompileSpirv(std::string_view path, std::string_view source, ShaderType type)
     {
+        FL_PROFILE_FUNCTION();
+
         shaderc::Compiler compiler;
 		shaderc::CompileOptions options;
 
@@ -262,6 +264,8 @@ namespace Flourish::Vulkan
 
     void Shader::Reflect(const std::vector<u32>& compiledData)
     {
+        FL_PROFILE_FUNCTION();
+
         m_ReflectionData.clear();
         m_SpecializationReflection.clear();
 
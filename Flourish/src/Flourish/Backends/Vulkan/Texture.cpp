@@ -14,82 +14,9 @@ namespace Flourish::Vulkan
         : Flourish::Texture(createInfo)
     {
         m_IsReady = std::make_shared<bool>(false);
-        m_IsDepthImage = m_Info.Format == ColorFormat::Depth;
-        m_Format = Common::ConvertColorFormat(m_Info.Format);
-        m_IsStorageImage = m_Info.Usage & TextureUsageFlags::Compute;
-
-        PopulateFeatures();
 
-        // Populate initial image info
         bool hasInitialData = m_Info.InitialData && m_Info.InitialDataSize > 0;
-        VkImageCreateInfo imageInfo{};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.imageType = VK_IMAGE_TYPE_2D;
-        imageInfo.extent.depth = 1;
-        imageInfo.format = m_Format;
-        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-        imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
-        if (m_Info.Usage & TextureUsageFlags::Graphics)
-        {
-            if (m_IsDepthImage)
-                imageInfo.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-            else
-                imageInfo.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-            imageInfo.usage |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
-        }
-        if (m_IsStorageImage)
-            imageInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
-        if (hasInitialData || m_Info.Usage & TextureUsageFlags::Transfer)
-            imageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-        imageInfo.flags = m_Info.ArrayCount == 6 ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
-
-        VkImageFormatProperties formatProperties;
-        vkGetPhysicalDeviceImageFormatProperties(
-            Context::Devices().PhysicalDevice(),
-            imageInfo.format,
-            imageInfo.imageType,
-            imageInfo.tiling,
-            imageInfo.usage,
-            imageInfo.flags,
-            &formatProperties
-        );
-
-        // Clamp image sizes
-        u32 newWidth = std::min(m_Info.Width, formatProperties.maxExtent.width);
-        u32 newHeight = std::min(m_Info.Height, formatProperties.maxExtent.height);
-        u32 newArrayCount = std::min(m_Info.ArrayCount, formatProperties.maxArrayLayers);
-
-        // Calculate mip levels
-        u32 maxMipLevels = static_cast<u32>(floor(log2(std::max(m_Info.Width, m_Info.Height)))) + 1;
-        maxMipLevels = std::min(maxMipLevels, formatProperties.maxMipLevels);
-        if (m_Info.MipCount == 0)
-            m_MipLevels = maxMipLevels;
-        else
-            m_MipLevels = std::min(m_Info.MipCount, maxMipLevels);
-
-        if (m_MipLevels < m_Info.MipCount)
-            FL_LOG_WARN("Image was created with mip levels higher than is supported, so it was clamped to [%d]", m_MipLevels);
-        if (newWidth < m_Info.Width)
-            FL_LOG_WARN("Image was created with width higher than is supported, so it was clamped to [%d]", newWidth);
-        if (newHeight < m_Info.Height)
-            FL_LOG_WARN("Image was created with height higher than is supported, so it was clamped to [%d]", newHeight);
-        if (newArrayCount < m_Info.ArrayCount)
-            FL_LOG_WARN("Image was created with array count higher than is supported, so it was clamped to [%d]", newArrayCount);
-        
-        if (newWidth == 0 || newHeight == 0 || m_MipLevels == 0)
-        {
-            FL_LOG_ERROR(
-                "Failed to create image with invalid dimensions: W:%d, H:%d, Mips:%d",
-                newWidth, newHeight, m_MipLevels
-            );
-            throw std::exception();
-        }
-
-        m_Info.Width = newWidth;
-        m_Info.Height = newHeight;
-        m_Info.ArrayCount = newArrayCount;
+        VkImageCreateInfo imageInfo = PopulateImageInfo(hasInitialData);
 
         VkDeviceSize imageSize = ComputeTextureSize(m_Info.Format, m_Info.Width, m_Info.Height);
         
@@ -105,9 +32,11 @@ namespace Flourish::Vulkan
                 stagingBuffer,
                 stagingAlloc,
                 stagingAllocInfo,
-                std::max(imageSize, (VkDeviceSize)m_Info.InitialDataSize)
+                std::max(imageSize, (VkDeviceSize)m_Info.InitialDataSize),
+                m_Info.DebugName
             );
             memcpy(stagingAllocInfo.pMappedData, m_Info.InitialData, m_Info.InitialDataSize);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::StagingBytesUploaded, m_Info.InitialDataSize);
         }
 
         // Start a command buffer for transitioning / data transfer
@@ -123,12 +52,7 @@ namespace Flourish::Vulkan
             throw std::exception();
 
         // Create images & views
-        VkImageLayout currentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        imageInfo.extent.width = static_cast<u32>(m_Info.Width);
-        imageInfo.extent.height = static_cast<u32>(m_Info.Height);
-        imageInfo.mipLevels = m_MipLevels;
-        imageInfo.arrayLayers = m_Info.ArrayCount;
-        imageInfo.initialLayout = currentLayout;
+        VkImageLayout currentLayout = imageInfo.initialLayout;
         VmaAllocationCreateInfo allocCreateInfo{};
         allocCreateInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
         if (!FL_VK_CHECK_RESULT(vmaCreateImage(
@@ -141,37 +65,9 @@ namespace Flourish::Vulkan
         ), "Texture create image"))
             throw std::exception();
 
-        // Create the image view representing the entire texture but also
-        // one for each slice of the image (mip / layer)
-        ImageViewCreateInfo viewCreateInfo;
-        viewCreateInfo.Image = m_Image.Image;
-        viewCreateInfo.Format = m_Format;
-        viewCreateInfo.MipLevels = m_MipLevels;
-        viewCreateInfo.LayerCount = m_Info.ArrayCount;
-        viewCreateInfo.AspectFlags = m_IsDepthImage ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
-        m_Image.ImageView = CreateImageView(viewCreateInfo);
-        viewCreateInfo.LayerCount = 1;
-        viewCreateInfo.MipLevels = 1;
-        for (u32 i = 0; i < m_Info.ArrayCount; i++)
-        {
-            for (u32 j = 0; j < m_MipLevels; j++)
-            {
-                viewCreateInfo.BaseArrayLayer = i;
-                viewCreateInfo.BaseMip = j;
-                VkImageView layerView = CreateImageView(viewCreateInfo);
-                m_Image.SliceViews.push_back(layerView);
-                
-                #ifdef FL_USE_IMGUI
-                s_ImGuiMutex.lock();
-                m_Image.ImGuiHandles.push_back((void*)ImGui_ImplVulkan_AddTexture(
-                    m_Sampler,
-                    layerView,
-                    m_IsStorageImage ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-                ));
-                s_ImGuiMutex.unlock();
-                #endif
-            }
-        }
+        Context::MemoryTracker().Track(m_Image.Allocation, MemoryCategory::Texture, m_Info.DebugName);
+
+        CreateViews();
 
         // If we have initial data, we need to perform the data transfer and generate
         // the mipmaps (which can only occur on the graphics queue)
@@ -292,7 +188,10 @@ namespace Flourish::Vulkan
                         callback();
                     Context::Commands().FreeBuffer(allocInfo, cmdBuffer);
                     if (hasInitialData)
+                    {
+                        Context::MemoryTracker().Untrack(stagingAlloc);
                         vmaDestroyBuffer(Context::Allocator(), stagingBuffer, stagingAlloc);
+                    }
                 },
                 "Texture init free"
             );
@@ -305,7 +204,10 @@ namespace Flourish::Vulkan
                 m_Info.CreationCallback();
             Context::Commands().FreeBuffer(allocInfo, cmdBuffer);
             if (hasInitialData)
+            {
+                Context::MemoryTracker().Untrack(stagingAlloc);
                 vmaDestroyBuffer(Context::Allocator(), stagingBuffer, stagingAlloc);
+            }
         }
 
         m_Initialized = true;
@@ -327,6 +229,34 @@ namespace Flourish::Vulkan
         m_Initialized = true;
     }
 
+    Texture::Texture(const TextureCreateInfo& createInfo, VkMemoryRequirements& outRequirements)
+        : Flourish::Texture(createInfo)
+    {
+        if (m_Info.InitialData || m_Info.AsyncCreation)
+        {
+            FL_LOG_ERROR("Transient textures cannot be created with initial data or asynchronously");
+            throw std::exception();
+        }
+
+        m_IsReady = std::make_shared<bool>(false);
+        m_IsTransient = true;
+        m_TransientImageInfo = PopulateImageInfo(false);
+
+        CreateSampler();
+
+        if (!FL_VK_CHECK_RESULT(vkCreateImage(
+            Context::Devices().Device(),
+            &m_TransientImageInfo,
+            nullptr,
+            &m_Image.Image
+        ), "Texture create transient image"))
+            throw std::exception();
+
+        vkGetImageMemoryRequirements(Context::Devices().Device(), m_Image.Image, &outRequirements);
+
+        m_Initialized = true;
+    }
+
     void Texture::operator=(Texture&& other)
     {
         Cleanup();
@@ -339,14 +269,54 @@ namespace Flourish::Vulkan
         m_Sampler = other.m_Sampler;
         m_IsDepthImage = other.m_IsDepthImage;
         m_IsStorageImage = other.m_IsStorageImage;
+        m_IsTransient = other.m_IsTransient;
+        m_TransientImageInfo = other.m_TransientImageInfo;
         m_IsReady = other.m_IsReady;
 
         other.m_Initialized = false;
         m_Initialized = true;
     }
 
+    void Texture::BindTransientMemory(VmaAllocation allocation, VkDeviceSize offset)
+    {
+        FL_ASSERT(m_IsTransient, "Cannot bind memory to a texture that is not transient");
+
+        // Images can only be bound once, so moving to a new placement requires a new image. Identical
+        // create infos are guaranteed to have identical memory requirements
+        if (m_Image.Allocation)
+        {
+            FinalizeImage(m_Image, VK_NULL_HANDLE);
+
+            m_Image = ImageData();
+            if (!FL_VK_CHECK_RESULT(vkCreateImage(
+                Context::Devices().Device(),
+                &m_TransientImageInfo,
+                nullptr,
+                &m_Image.Image
+            ), "Texture recreate transient image"))
+                throw std::exception();
+        }
+
+        if (!FL_VK_CHECK_RESULT(vmaBindImageMemory2(
+            Context::Allocator(),
+            allocation,
+            offset,
+            m_Image.Image,
+            nullptr
+        ), "Texture bind transient memory"))
+            throw std::exception();
+
+        m_Image.Allocation = allocation;
+        CreateViews();
+
+        *m_IsReady = true;
+    }
+
     Texture::~Texture()
     {
+        // The submission thread may still be recording the frame that referenced this
+        Context::SubmissionHandler().WaitOnSubmissionThread();
+
         Cleanup();
     }
 
@@ -448,6 +418,7 @@ namespace Flourish::Vulkan
             ibCreateInfo.MemoryType = BufferMemoryType::GPUOnly;
             ibCreateInfo.ElementCount = 1;
             ibCreateInfo.Stride = bufferSize;
+            ibCreateInfo.Category = MemoryCategory::Staging;
             Buffer tempBuffer(
                 ibCreateInfo,
                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
@@ -465,23 +436,18 @@ namespace Flourish::Vulkan
                 cmdBuffer
             );
 
-            VkBufferMemoryBarrier bufBarrier{};
-            bufBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            VkBufferMemoryBarrier2KHR bufBarrier{};
+            bufBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
             bufBarrier.buffer = tempBuffer.GetGPUBuffer();
             bufBarrier.size = bufferSize;
             bufBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
             bufBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            bufBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            bufBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-            vkCmdPipelineBarrier(
-                cmdBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                0,
-                0, nullptr,
-                1, &bufBarrier,
-                0, nullptr
-            );
+            bufBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT_KHR;
+            bufBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+            bufBarrier.dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT_KHR;
+            bufBarrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT_KHR;
+            Synchronization::BufferBarrier(cmdBuffer, bufBarrier);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
             Buffer::CopyBufferToImage(
                 tempBuffer.GetGPUBuffer(),
@@ -560,8 +526,8 @@ namespace Flourish::Vulkan
             );
         }
 
-        VkImageMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        VkImageMemoryBarrier2KHR barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
         barrier.image = image;
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
@@ -578,15 +544,13 @@ namespace Flourish::Vulkan
             barrier.subresourceRange.baseMipLevel = i - 1;
             barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-
-            vkCmdPipelineBarrier(cmdBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
+            barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR;
+            barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+            barrier.dstStageMask = VK_PIPELINE_STAGE_2_BLIT_BIT_KHR;
+            barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT_KHR;
+
+            Synchronization::ImageBarrier(cmdBuffer, barrier);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
             VkImageBlit blit{};
             blit.srcOffsets[0] = { 0, 0, 0 };
@@ -615,16 +579,13 @@ namespace Flourish::Vulkan
                 barrier.subresourceRange.baseMipLevel = i;
                 barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
                 barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-                vkCmdPipelineBarrier(cmdBuffer,
-                    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                    0,
-                    0, nullptr,
-                    0, nullptr,
-                    1, &barrier
-                );
+                barrier.srcStageMask = VK_PIPELINE_STAGE_2_BLIT_BIT_KHR;
+                barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+                barrier.dstStageMask = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
+                barrier.dstAccessMask = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR;
+
+                Synchronization::ImageBarrier(cmdBuffer, barrier);
+                Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
             }
 
             if (mipWidth > 1) mipWidth /= 2;
@@ -636,17 +597,13 @@ namespace Flourish::Vulkan
         barrier.newLayout = finalLayout;
         barrier.subresourceRange.baseMipLevel = 0;
         barrier.subresourceRange.levelCount = mipLevels;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        vkCmdPipelineBarrier(cmdBuffer,
-            VK_PIPELINE_STAGE_TRANSFER_BIT,
-            VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-            0,
-            0, nullptr,
-            0, nullptr,
-            1, &barrier
-        );
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR;
+        barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
+        barrier.dstAccessMask = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR;
+
+        Synchronization::ImageBarrier(cmdBuffer, barrier);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
         if (!buffer)
         {
@@ -689,14 +646,17 @@ namespace Flourish::Vulkan
             FL_VK_ENSURE_RESULT(vkBeginCommandBuffer(cmdBuffer, &beginInfo), "TransitionImageLayout command buffer begin");
         }
 
-        VkImageMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        // Legacy masks are valid synchronization2 masks, so they are passed through as is
+        VkImageMemoryBarrier2KHR barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
         barrier.oldLayout = oldLayout;
         barrier.newLayout = newLayout;
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.image = image;
+        barrier.srcStageMask = srcStage;
         barrier.srcAccessMask = srcAccessMask;
+        barrier.dstStageMask = dstStage;
         barrier.dstAccessMask = dstAccessMask;
         barrier.subresourceRange.aspectMask = imageAspect;
         barrier.subresourceRange.baseMipLevel = baseMip;
@@ -704,14 +664,8 @@ namespace Flourish::Vulkan
         barrier.subresourceRange.baseArrayLayer = baseLayer;
         barrier.subresourceRange.layerCount = layerCount;
         
-        vkCmdPipelineBarrier(
-            cmdBuffer,
-            srcStage, dstStage,
-            0,
-            0, nullptr,
-            0, nullptr,
-            1, &barrier
-        );
+        Synchronization::ImageBarrier(cmdBuffer, barrier);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
 
         if (!buffer)
         {
@@ -759,6 +713,128 @@ namespace Flourish::Vulkan
         return view;
     }
 
+    VkImageCreateInfo Texture::PopulateImageInfo(bool hasInitialData)
+    {
+        m_IsDepthImage = m_Info.Format == ColorFormat::Depth;
+        m_Format = Common::ConvertColorFormat(m_Info.Format);
+        m_IsStorageImage = m_Info.Usage & TextureUsageFlags::Compute;
+
+        PopulateFeatures();
+
+        // Populate initial image info
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.depth = 1;
+        imageInfo.format = m_Format;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+        if (m_Info.Usage & TextureUsageFlags::Graphics)
+        {
+            if (m_IsDepthImage)
+                imageInfo.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+            else
+                imageInfo.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+            imageInfo.usage |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+        }
+        if (m_IsStorageImage)
+            imageInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+        if (hasInitialData || m_Info.Usage & TextureUsageFlags::Transfer)
+            imageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.flags = m_Info.ArrayCount == 6 ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
+
+        VkImageFormatProperties formatProperties;
+        vkGetPhysicalDeviceImageFormatProperties(
+            Context::Devices().PhysicalDevice(),
+            imageInfo.format,
+            imageInfo.imageType,
+            imageInfo.tiling,
+            imageInfo.usage,
+            imageInfo.flags,
+            &formatProperties
+        );
+
+        // Clamp image sizes
+        u32 newWidth = std::min(m_Info.Width, formatProperties.maxExtent.width);
+        u32 newHeight = std::min(m_Info.Height, formatProperties.maxExtent.height);
+        u32 newArrayCount = std::min(m_Info.ArrayCount, formatProperties.maxArrayLayers);
+
+        // Calculate mip levels
+        u32 maxMipLevels = static_cast<u32>(floor(log2(std::max(m_Info.Width, m_Info.Height)))) + 1;
+        maxMipLevels = std::min(maxMipLevels, formatProperties.maxMipLevels);
+        if (m_Info.MipCount == 0)
+            m_MipLevels = maxMipLevels;
+        else
+            m_MipLevels = std::min(m_Info.MipCount, maxMipLevels);
+
+        if (m_MipLevels < m_Info.MipCount)
+            FL_LOG_WARN("Image was created with mip levels higher than is supported, so it was clamped to [%d]", m_MipLevels);
+        if (newWidth < m_Info.Width)
+            FL_LOG_WARN("Image was created with width higher than is supported, so it was clamped to [%d]", newWidth);
+        if (newHeight < m_Info.Height)
+            FL_LOG_WARN("Image was created with height higher than is supported, so it was clamped to [%d]", newHeight);
+        if (newArrayCount < m_Info.ArrayCount)
+            FL_LOG_WARN("Image was created with array count higher than is supported, so it was clamped to [%d]", newArrayCount);
+        
+        if (newWidth == 0 || newHeight == 0 || m_MipLevels == 0)
+        {
+            FL_LOG_ERROR(
+                "Failed to create image with invalid dimensions: W:%d, H:%d, Mips:%d",
+                newWidth, newHeight, m_MipLevels
+            );
+            throw std::exception();
+        }
+
+        m_Info.Width = newWidth;
+        m_Info.Height = newHeight;
+        m_Info.ArrayCount = newArrayCount;
+
+        imageInfo.extent.width = static_cast<u32>(m_Info.Width);
+        imageInfo.extent.height = static_cast<u32>(m_Info.Height);
+        imageInfo.mipLevels = m_MipLevels;
+        imageInfo.arrayLayers = m_Info.ArrayCount;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        return imageInfo;
+    }
+
+    void Texture::CreateViews()
+    {
+        // Create the image view representing the entire texture but also
+        // one for each slice of the image (mip / layer)
+        ImageViewCreateInfo viewCreateInfo;
+        viewCreateInfo.Image = m_Image.Image;
+        viewCreateInfo.Format = m_Format;
+        viewCreateInfo.MipLevels = m_MipLevels;
+        viewCreateInfo.LayerCount = m_Info.ArrayCount;
+        viewCreateInfo.AspectFlags = m_IsDepthImage ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        m_Image.ImageView = CreateImageView(viewCreateInfo);
+        viewCreateInfo.LayerCount = 1;
+        viewCreateInfo.MipLevels = 1;
+        for (u32 i = 0; i < m_Info.ArrayCount; i++)
+        {
+            for (u32 j = 0; j < m_MipLevels; j++)
+            {
+                viewCreateInfo.BaseArrayLayer = i;
+                viewCreateInfo.BaseMip = j;
+                VkImageView layerView = CreateImageView(viewCreateInfo);
+                m_Image.SliceViews.push_back(layerView);
+                
+                #ifdef FL_USE_IMGUI
+                s_ImGuiMutex.lock();
+                m_Image.ImGuiHandles.push_back((void*)ImGui_ImplVulkan_AddTexture(
+                    m_Sampler,
+                    layerView,
+                    m_IsStorageImage ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                ));
+                s_ImGuiMutex.unlock();
+                #endif
+            }
+        }
+    }
+
     void Texture::PopulateFeatures()
     {
         VkFormatProperties props;
@@ -816,32 +892,46 @@ namespace Flourish::Vulkan
         if (!m_Initialized) return;
         m_Initialized = false;
 
-        auto sampler = m_Sampler;
-        auto image = m_Image;
-        Context::FinalizerQueue().Push([=]()
+        // Transient textures only own their image and views, since the
+        // memory belongs to the graph that placed them
+        if (m_IsTransient)
+            FinalizeImage(m_Image, VK_NULL_HANDLE);
+        // Texture objects wrapping texture views will not have an allocation
+        // so there will be nothing to free
+        else if (m_Image.Allocation)
+            FinalizeImage(m_Image, m_Image.Allocation);
+        else
+            FinalizeImGuiHandles(m_Image);
+
+        Context::FinalizerQueue().PushSampler(m_Sampler);
+    }
+
+    void Texture::FinalizeImage(const ImageData& image, VmaAllocation allocation)
+    {
+        FinalizeImGuiHandles(image);
+
+        auto& finalizer = Context::FinalizerQueue();
+        for (auto view : image.SliceViews)
+            finalizer.PushImageView(view);
+        finalizer.PushImageView(image.ImageView);
+        finalizer.PushImage(image.Image, allocation);
+    }
+
+    void Texture::FinalizeImGuiHandles(const ImageData& image)
+    {
+        #ifdef FL_USE_IMGUI
+        if (image.ImGuiHandles.empty())
+            return;
+
+        auto handles = image.ImGuiHandles;
+        Context::FinalizerQueue().Push([handles]()
         {
-            auto device = Context::Devices().Device();
-            
-            #ifdef FL_USE_IMGUI
             s_ImGuiMutex.lock();
-            for (auto handle : image.ImGuiHandles)
+            for (auto handle : handles)
                 if (handle)
                     ImGui_ImplVulkan_RemoveTexture((VkDescriptorSet)handle);
             s_ImGuiMutex.unlock();
-            #endif
-            
-            // Texture objects wrapping texture views will not have an allocation
-            // so there will be nothing to free
-            if (image.Allocation)
-            {
-                for (auto view : image.SliceViews)
-                    vkDestroyImageView(device, view, nullptr);
-                vkDestroyImageView(device, image.ImageView, nullptr);
-                vmaDestroyImage(Context::Allocator(), image.Image, image.Allocation);
-            }
-
-            if (sampler) 
-                vkDestroySampler(device, sampler, nullptr);
-        }, "Texture free");
+        }, "Texture ImGui free");
+        #endif
     }
 }
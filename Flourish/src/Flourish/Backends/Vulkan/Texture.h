@@ -25,6 +25,10 @@ namespace Flourish::Vulkan
     public:
         Texture(const TextureCreateInfo& createInfo);
         Texture(const TextureCreateInfo& createInfo, VkImageView imageView);
+
+        // Transient textures are created without memory, which is bound by the owning graph when it
+        // is built. Views only exist once memory has been bound
+        Texture(const TextureCreateInfo& createInfo, VkMemoryRequirements& outRequirements);
         ~Texture() override;
         void operator=(Texture&& other);
 
@@ -43,6 +47,15 @@ namespace Flourish::Vulkan
         inline VkSampler GetSampler() const { return m_Sampler; }
         inline VkFormatFeatureFlags GetFormatFeatures() const { return m_FeatureFlags; }
         inline bool IsDepthImage() const { return m_IsDepthImage; }
+        inline bool IsStorageImage() const { return m_IsStorageImage; }
+
+        inline bool IsTransient() const { return m_IsTransient; }
+
+        // Binding a texture that was already bound recreates its image and views
+        void BindTransientMemory(VmaAllocation allocation, VkDeviceSize offset);
+
+        // Layout the texture is left in between graph encoders
+        inline VkImageLayout GetRestingLayout() const { return m_IsStorageImage ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL; }
         
     public:
         static void GenerateMipmaps(
@@ -111,10 +124,17 @@ namespace Flourish::Vulkan
         };
 
     private:
+        VkImageCreateInfo PopulateImageInfo(bool hasInitialData);
+        void CreateViews();
         void PopulateFeatures();
         void CreateSampler();
         void Cleanup();
 
+    private:
+        // Queues the image and its views for destruction, freeing the allocation if one is given
+        static void FinalizeImage(const ImageData& image, VmaAllocation allocation);
+        static void FinalizeImGuiHandles(const ImageData& image);
+
     private:
         ImageData m_Image;
         VkFormat m_Format;
@@ -122,7 +142,9 @@ namespace Flourish::Vulkan
         VkSampler m_Sampler = VK_NULL_HANDLE;
         bool m_IsDepthImage = false;
         bool m_IsStorageImage = false;
+        bool m_IsTransient = false;
         bool m_Initialized = false;
+        VkImageCreateInfo m_TransientImageInfo{};
 
         // TODO: remove this and use an upload system like buffers 
         std::shared_ptr<bool> m_IsReady = nullptr;
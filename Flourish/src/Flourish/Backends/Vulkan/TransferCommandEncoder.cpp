@@ -16,6 +16,7 @@ namespace Flourish::Vulkan
     {
         m_Encoding = true;
         m_AnyCommandRecorded = false;
+        m_LayoutTracker.Reset();
 
         m_Submission.Buffers.resize(1);
         m_Submission.AllocInfo = Context::Commands().AllocateBuffers(
@@ -44,6 +45,9 @@ namespace Flourish::Vulkan
         FL_CRASH_ASSERT(m_Encoding, "Cannot end encoding that has already ended");
         m_Encoding = false;
 
+        // Textures must be back in their resting layout before the graph moves on
+        m_LayoutTracker.Restore(m_CommandBuffer);
+
         vkEndCommandBuffer(m_CommandBuffer);
 
         if (!m_AnyCommandRecorded)
@@ -70,20 +74,16 @@ namespace Flourish::Vulkan
         Texture* texture = static_cast<Texture*>(_texture);
         Buffer* buffer = static_cast<Buffer*>(_buffer);
         
-        VkImageLayout startingLayout = (texture->GetUsageType() & TextureUsageFlags::Compute) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         VkImageAspectFlags aspect = texture->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
 
-        Texture::TransitionImageLayout(
-            texture->GetImage(),
-            startingLayout,
+        m_LayoutTracker.Require(
+            texture,
+            layerIndex, mipLevel,
             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            aspect,
-            mipLevel, 1,
-            layerIndex, 1,
-            0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-            VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            m_CommandBuffer
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR,
+            VK_ACCESS_2_TRANSFER_READ_BIT_KHR
         );
+        m_LayoutTracker.Flush(m_CommandBuffer);
 
         Buffer::CopyImageToBuffer(
             texture->GetImage(),
@@ -97,18 +97,6 @@ namespace Flourish::Vulkan
             m_CommandBuffer
         );
 
-        Texture::TransitionImageLayout(
-            texture->GetImage(),
-            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            startingLayout,
-            aspect,
-            mipLevel, 1,
-            layerIndex, 1,
-            VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-            m_CommandBuffer
-        );
-
         m_AnyCommandRecorded = true;
     }
 
@@ -120,20 +108,16 @@ namespace Flourish::Vulkan
         Texture* texture = static_cast<Texture*>(_texture);
         Buffer* buffer = static_cast<Buffer*>(_buffer);
 
-        VkImageLayout startingLayout = (texture->GetUsageType() & TextureUsageFlags::Compute) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         VkImageAspectFlags aspect = texture->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
 
-        Texture::TransitionImageLayout(
-            texture->GetImage(),
-            startingLayout,
+        m_LayoutTracker.Require(
+            texture,
+            layerIndex, mipLevel,
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            aspect,
-            mipLevel, 1,
-            layerIndex, 1,
-            0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-            VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            m_CommandBuffer
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR,
+            VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR
         );
+        m_LayoutTracker.Flush(m_CommandBuffer);
 
         Buffer::CopyBufferToImage(
             buffer->GetGPUBuffer(),
@@ -147,17 +131,6 @@ namespace Flourish::Vulkan
             m_CommandBuffer
         );
 
-        Texture::TransitionImageLayout(
-            texture->GetImage(),
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            startingLayout,
-            aspect,
-            mipLevel, 1,
-            layerIndex, 1,            
-            VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-            0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-            m_CommandBuffer
-        );
         m_AnyCommandRecorded = true;
     }
 
@@ -3,6 +3,7 @@
 #include "Flourish/Api/TransferCommandEncoder.h"
 #include "Flourish/Backends/Vulkan/Util/Common.h"
 #include "Flourish/Backends/Vulkan/Util/Commands.h"
+#include "Flourish/Backends/Vulkan/Util/ImageLayoutTracker.h"
 
 namespace Flourish::Vulkan
 {
@@ -30,5 +31,6 @@ namespace Flourish::Vulkan
         VkCommandBuffer m_CommandBuffer;
         CommandBufferEncoderSubmission m_Submission;
         CommandBuffer* m_ParentBuffer;
+        ImageLayoutTracker m_LayoutTracker;
     };
 }
@@ -178,6 +178,11 @@ namespace Flourish::Vulkan
             s_ThreadPools.FramePools[Flourish::Context::FrameIndex()]->GetBuffers(workloadType, secondary, buffers, bufferCount);
         }
 
+        Flourish::Context::IncrementFrameCounter(
+            secondary ? FrameCounter::SecondaryCommandBuffersAllocated : FrameCounter::PrimaryCommandBuffersAllocated,
+            bufferCount
+        );
+
         return { std::this_thread::get_id(), persistent ? s_ThreadPools.PersistentPools.get() : nullptr, workloadType };
     }
 
@@ -162,6 +162,8 @@ namespace Flourish::Vulkan
 
         m_PoolsMutex.unlock();
 
+        Flourish::Context::IncrementFrameCounter(FrameCounter::DescriptorSetsAllocated);
+
         return { set, poolIndex };
     }
 
@@ -25,7 +25,8 @@ namespace Flourish::Vulkan
 
         if (repopulate || device->m_SupportsTimelines)
             next = Common::IterateAndWriteNextChain(next, &TimelineFeatures);
-        //next = Common::IterateAndWriteNextChain(next, &Sync2Features);
+        if (repopulate || device->m_SupportsSync2)
+            next = Common::IterateAndWriteNextChain(next, &Sync2Features);
 
         if (features.RayTracing || features.BufferGPUAddress)
             next = Common::IterateAndWriteNextChain(next, &BufferAddrFeatures);
@@ -51,9 +52,10 @@ namespace Flourish::Vulkan
 
         // Required physical device extensions
         std::vector<const char*> deviceExtensions = {
-            VK_KHR_SWAPCHAIN_EXTENSION_NAME,
             VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME // VK 1.2
         };
+        if (!initInfo.Headless)
+            deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 
         // Get devices
         u32 deviceCount = 0;
@@ -107,16 +109,18 @@ namespace Flourish::Vulkan
         PopulateDeviceProperties();
         PopulateOptionalExtensions(deviceExtensions, initInfo);
 
-        // Get the max amount of queues we can/need to create for each family
+        // Create every queue each family advertises so that independent submissions can be spread across them
         QueueFamilyIndices indices = Queues::GetQueueFamilies(m_PhysicalDevice);
         std::vector<float> queuePriorities;
         std::unordered_map<u32, u32> uniqueFamilies;
-        u32 bufferCount = Flourish::Context::FrameBufferCount();
-        queuePriorities.reserve(4 * bufferCount);
-        uniqueFamilies[indices.PresentFamily.value()] = std::min(indices.PresentQueueCount, bufferCount);
-        uniqueFamilies[indices.GraphicsFamily.value()] = std::min(indices.GraphicsQueueCount, bufferCount);
-        uniqueFamilies[indices.ComputeFamily.value()] = std::min(indices.ComputeQueueCount, bufferCount);
-        uniqueFamilies[indices.TransferFamily.value()] = std::min(indices.TransferQueueCount, bufferCount);
+        uniqueFamilies[indices.PresentFamily.value()] = indices.PresentQueueCount;
+        uniqueFamilies[indices.GraphicsFamily.value()] = indices.GraphicsQueueCount;
+        uniqueFamilies[indices.ComputeFamily.value()] = indices.ComputeQueueCount;
+        uniqueFamilies[indices.TransferFamily.value()] = indices.TransferQueueCount;
+        u32 totalQueueCount = 0;
+        for (auto& pair : uniqueFamilies)
+            totalQueueCount += pair.second;
+        queuePriorities.reserve(totalQueueCount);
 
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
         for (auto& pair : uniqueFamilies)
@@ -302,6 +306,14 @@ namespace Flourish::Vulkan
                 extensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
             #endif
         }
+
+        if (supported.Sync2Features.synchronization2 &&
+            Common::SupportsExtension(m_SupportedExtensions, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            m_SupportsSync2 = true;
+            m_Features.Sync2Features.synchronization2 = true;
+            extensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+        }
         
         if (initInfo.RequestedFeatures.SamplerAnisotropy)
         {
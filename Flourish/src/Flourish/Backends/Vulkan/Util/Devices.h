@@ -35,6 +35,7 @@ namespace Flourish::Vulkan
         inline const auto& RayTracingProperties() const { return m_RayTracingProperties; }
         inline const auto& AccelStructureProperties() const { return m_AccelStructureProperties; }
         inline bool SupportsTimelines() const { return m_SupportsTimelines; }
+        inline bool SupportsSync2() const { return m_SupportsSync2; }
         inline bool SupportsSpirv14() const { return m_SupportsSpirv14; }
         inline bool SupportsMemoryBudget() const { return m_SupportsMemoryBudget; }
         inline bool SupportsFullScreenExclusive() const { return m_FullScreenExclusive; }
@@ -61,6 +62,7 @@ namespace Flourish::Vulkan
         VkDevice m_Device;
         DeviceFeatures m_Features;
         bool m_SupportsTimelines = false;
+        bool m_SupportsSync2 = false;
         bool m_SupportsSpirv14 = false;
         bool m_SupportsMemoryBudget = false;
         bool m_FullScreenExclusive = false;
@@ -43,10 +43,118 @@ namespace Flourish::Vulkan
         m_QueueLock.unlock();
     }
 
+    void FinalizerQueue::PushAsync(
+        std::function<void()> executeFunc,
+        VkSemaphore semaphore,
+        u64 value,
+        const char* debugName)
+    {
+        m_QueueLock.lock();
+        TimelineEntries* timeline = nullptr;
+        for (auto& existing : m_TimelineQueues)
+        {
+            if (existing.Semaphore == semaphore)
+            {
+                timeline = &existing;
+                break;
+            }
+        }
+        if (!timeline)
+        {
+            timeline = &m_TimelineQueues.emplace_back();
+            timeline->Semaphore = semaphore;
+        }
+
+        timeline->Entries.emplace_back(executeFunc, debugName, value);
+        m_TimelineEntryCount++;
+        m_QueueLock.unlock();
+    }
+
+    void FinalizerQueue::PushBuffer(VkBuffer buffer, VmaAllocation allocation)
+    {
+        if (!buffer) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::Buffer;
+        record.Buffer = buffer;
+        record.Allocation = allocation;
+        PushRecord(record);
+    }
+
+    void FinalizerQueue::PushImage(VkImage image, VmaAllocation allocation)
+    {
+        if (!image) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::Image;
+        record.Image = image;
+        record.Allocation = allocation;
+        PushRecord(record);
+    }
+
+    void FinalizerQueue::PushImageView(VkImageView view)
+    {
+        if (!view) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::ImageView;
+        record.ImageView = view;
+        record.Allocation = VK_NULL_HANDLE;
+        PushRecord(record);
+    }
+
+    void FinalizerQueue::PushSampler(VkSampler sampler)
+    {
+        if (!sampler) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::Sampler;
+        record.Sampler = sampler;
+        record.Allocation = VK_NULL_HANDLE;
+        PushRecord(record);
+    }
+
+    void FinalizerQueue::PushPipeline(VkPipeline pipeline)
+    {
+        if (!pipeline) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::Pipeline;
+        record.Pipeline = pipeline;
+        record.Allocation = VK_NULL_HANDLE;
+        PushRecord(record);
+    }
+
+    void FinalizerQueue::PushPipelineLayout(VkPipelineLayout layout)
+    {
+        if (!layout) return;
+
+        FinalizerRecord record;
+        record.Type = FinalizerRecordType::PipelineLayout;
+        record.PipelineLayout = layout;
+        record.Allocation = VK_NULL_HANDLE;
+        PushRecord(record);
+    }
+
     void FinalizerQueue::Iterate(bool force)
     {
         FL_PROFILE_FUNCTION();
 
+        if (force)
+        {
+            for (auto& bucket : m_RecordBuckets)
+                RetireBucket(bucket);
+        }
+        else
+        {
+            // Records pushed before iteration N retire on iteration N + lifetime, matching Push entries
+            u32 lifetime = Flourish::Context::FrameBufferCount() * 2 + 1;
+            m_IterateCount++;
+            m_PushBucket.store(static_cast<u32>(m_IterateCount % RecordBucketCount));
+            if (m_IterateCount > lifetime)
+                RetireBucket(m_RecordBuckets[(m_IterateCount - lifetime - 1) % RecordBucketCount]);
+        }
+
         m_QueueLock.lock();
         for (int i = 0; i < m_Queue.size(); i++)
         {
@@ -69,16 +177,150 @@ namespace Flourish::Vulkan
             
             if (execute || force)
             {
-                if (value.DebugName)
-                { FL_LOG_TRACE("Finalizer: %s", value.DebugName); }
                 m_QueueLock.unlock();
-                value.Execute();
-                value.Execute = nullptr; // Ensure function data gets cleaned up before relocking
+                ExecuteEntry(value);
                 m_QueueLock.lock();
                 m_Queue.erase(m_Queue.begin() + i);
                 i -= 1;
             }
         }
+
+        // Timeline entries only cost a semaphore query plus the entries that are ready. Queues are looked up by
+        // index since finalizers may push new entries while the lock is released
+        for (u32 i = 0; i < m_TimelineQueues.size(); i++)
+        {
+            if (m_TimelineQueues[i].Entries.empty())
+                continue;
+
+            VkSemaphore semaphore = m_TimelineQueues[i].Semaphore;
+            m_QueueLock.unlock();
+            u64 completedValue = force ? UINT64_MAX : Synchronization::GetSemaphoreValue(semaphore);
+            m_QueueLock.lock();
+
+            while (true)
+            {
+                auto& entries = m_TimelineQueues[i].Entries;
+                if (entries.empty() || entries.front().WaitValue > completedValue)
+                    break;
+
+                DeleteEntry entry = std::move(entries.front());
+                entries.pop_front();
+                m_TimelineEntryCount--;
+
+                m_QueueLock.unlock();
+                ExecuteEntry(entry);
+                m_QueueLock.lock();
+            }
+        }
         m_QueueLock.unlock();
     }
+
+    bool FinalizerQueue::IsEmpty() const
+    {
+        for (auto& bucket : m_RecordBuckets)
+            if (bucket.Count.load() > 0)
+                return false;
+
+        return m_Queue.empty() && m_TimelineEntryCount == 0;
+    }
+
+    void FinalizerQueue::PushRecord(const FinalizerRecord& record)
+    {
+        while (true)
+        {
+            u32 bucketIndex = m_PushBucket.load();
+            auto& bucket = m_RecordBuckets[bucketIndex];
+
+            // The bucket may have rotated out between loading it and registering as a writer, in which case
+            // it could be retiring. Anything registered before the check is waited on by the retire
+            bucket.Writers.fetch_add(1);
+            if (m_PushBucket.load() != bucketIndex)
+            {
+                bucket.Writers.fetch_sub(1);
+                continue;
+            }
+
+            u32 recordIndex = bucket.Count.fetch_add(1);
+            if (recordIndex < bucket.Records.size())
+                bucket.Records[recordIndex] = record;
+            else
+            {
+                m_OverflowLock.lock();
+                bucket.Overflow.emplace_back(record);
+                m_OverflowLock.unlock();
+            }
+
+            bucket.Writers.fetch_sub(1);
+            return;
+        }
+    }
+
+    void FinalizerQueue::RetireBucket(RecordBucket& bucket)
+    {
+        // Writers that loaded the bucket while it was current are either done or about to back off
+        while (bucket.Writers.load() != 0)
+            std::this_thread::yield();
+
+        u32 totalCount = bucket.Count.load();
+        if (totalCount == 0)
+            return;
+
+        FL_PROFILE_FUNCTION();
+
+        auto device = Context::Devices().Device();
+        u32 recordCount = std::min(totalCount, static_cast<u32>(bucket.Records.size()));
+        const auto destroyRecord = [device](const FinalizerRecord& record)
+        {
+            switch (record.Type)
+            {
+                default: break;
+                case FinalizerRecordType::ImageView: { vkDestroyImageView(device, record.ImageView, nullptr); } break;
+                case FinalizerRecordType::Sampler: { vkDestroySampler(device, record.Sampler, nullptr); } break;
+                case FinalizerRecordType::Pipeline: { vkDestroyPipeline(device, record.Pipeline, nullptr); } break;
+                case FinalizerRecordType::PipelineLayout: { vkDestroyPipelineLayout(device, record.PipelineLayout, nullptr); } break;
+                case FinalizerRecordType::Image: { vkDestroyImage(device, record.Image, nullptr); } break;
+                case FinalizerRecordType::Buffer: { vkDestroyBuffer(device, record.Buffer, nullptr); } break;
+            }
+        };
+
+        // Destroy by type so that views are gone before their images and calls of the same kind are grouped
+        for (u32 type = 0; type < static_cast<u32>(FinalizerRecordType::Count); type++)
+        {
+            for (u32 i = 0; i < recordCount; i++)
+                if (static_cast<u32>(bucket.Records[i].Type) == type)
+                    destroyRecord(bucket.Records[i]);
+            for (auto& record : bucket.Overflow)
+                if (static_cast<u32>(record.Type) == type)
+                    destroyRecord(record);
+        }
+
+        // Memory is released once every handle bound to it is gone, all in one call
+        m_RetiredAllocations.clear();
+        for (u32 i = 0; i < recordCount; i++)
+            if (bucket.Records[i].Allocation)
+                m_RetiredAllocations.emplace_back(bucket.Records[i].Allocation);
+        for (auto& record : bucket.Overflow)
+            if (record.Allocation)
+                m_RetiredAllocations.emplace_back(record.Allocation);
+        if (!m_RetiredAllocations.empty())
+        {
+            u32 allocationCount = static_cast<u32>(m_RetiredAllocations.size());
+            Context::MemoryTracker().Untrack(m_RetiredAllocations.data(), allocationCount);
+            vmaFreeMemoryPages(Context::Allocator(), allocationCount, m_RetiredAllocations.data());
+        }
+
+        Flourish::Context::IncrementFrameCounter(FrameCounter::FinalizerEntriesExecuted, totalCount);
+
+        bucket.Count.store(0);
+        bucket.Overflow.clear();
+    }
+
+    void FinalizerQueue::ExecuteEntry(DeleteEntry& entry)
+    {
+        if (entry.DebugName)
+        { FL_LOG_TRACE("Finalizer: %s", entry.DebugName); }
+        entry.Execute();
+        entry.Execute = nullptr; // Ensure function data gets cleaned up before relocking
+        Flourish::Context::IncrementFrameCounter(FrameCounter::FinalizerEntriesExecuted);
+    }
 }
@@ -3,8 +3,39 @@
 #include "Flourish/Api/RenderContext.h"
 #include "Flourish/Backends/Vulkan/Util/Common.h"
 
+#include <atomic>
+
 namespace Flourish::Vulkan
 {
+    // Handles that can be finalized through plain records. Retired records are destroyed in this order
+    enum class FinalizerRecordType : u32
+    {
+        ImageView = 0,
+        Sampler,
+        Pipeline,
+        PipelineLayout,
+        Image,
+        Buffer,
+
+        Count
+    };
+
+    // Memory is freed once the handle is destroyed when an allocation is set
+    struct FinalizerRecord
+    {
+        FinalizerRecordType Type;
+        union
+        {
+            VkImageView ImageView;
+            VkSampler Sampler;
+            VkPipeline Pipeline;
+            VkPipelineLayout PipelineLayout;
+            VkImage Image;
+            VkBuffer Buffer;
+        };
+        VmaAllocation Allocation;
+    };
+
     struct DeleteEntry
     {
         DeleteEntry(
@@ -19,10 +50,15 @@ namespace Flourish::Vulkan
             WaitFences.assign(fences, fences + fenceCount);
         }
 
+        DeleteEntry(std::function<void()> execute, const char* debugName, u64 waitValue)
+            : Execute(execute), DebugName(debugName), WaitValue(waitValue)
+        {}
+
         u32 Lifetime = 0; // Frames
         std::function<void()> Execute;
         const char* DebugName;
         std::vector<VkFence> WaitFences;
+        u64 WaitValue = 0; // Of the timeline semaphore the entry is queued on
     };
 
     class FinalizerQueue
@@ -43,13 +79,71 @@ namespace Flourish::Vulkan
             u32 fenceCount = 0,
             const char* debugName = nullptr
         );
+
+        // TS
+        // Will run a delete operation once the timeline semaphore reaches the value. Each semaphore is
+        // queried once per iteration regardless of how many entries wait on it, so this is preferred over
+        // fences when timelines are supported
+        void PushAsync(
+            std::function<void()> executeFunc,
+            VkSemaphore semaphore,
+            u64 value,
+            const char* debugName = nullptr
+        );
+
+        // TS
+        // Same lifetime as Push, but records go into the current bucket without locking or allocating
+        // and whole buckets are destroyed at once. Preferred for anything that only destroys handles
+        void PushBuffer(VkBuffer buffer, VmaAllocation allocation = VK_NULL_HANDLE);
+        void PushImage(VkImage image, VmaAllocation allocation = VK_NULL_HANDLE);
+        void PushImageView(VkImageView view);
+        void PushSampler(VkSampler sampler);
+        void PushPipeline(VkPipeline pipeline);
+        void PushPipelineLayout(VkPipelineLayout layout);
+
+        // Must only be called from one thread at a time, normally once per frame
         void Iterate(bool force = false);
         
         // TS
-        inline bool IsEmpty() const { return m_Queue.empty(); }
+        bool IsEmpty() const;
+
+    private:
+        // Entries waiting on the same timeline semaphore in the order they were pushed. Values are mostly
+        // increasing, so iteration stops at the first entry that is not ready
+        struct TimelineEntries
+        {
+            VkSemaphore Semaphore;
+            std::deque<DeleteEntry> Entries;
+        };
+
+        // Records pushed between two iterations. Writers claim a slot with a single atomic add, and the bucket
+        // is only retired once no writer that might still see it as current is left
+        struct RecordBucket
+        {
+            std::array<FinalizerRecord, 1024> Records;
+            std::atomic<u32> Count = 0;
+            std::atomic<u32> Writers = 0;
+            std::vector<FinalizerRecord> Overflow; // Guarded by m_OverflowLock
+        };
+
+    private:
+        void ExecuteEntry(DeleteEntry& entry);
+        void PushRecord(const FinalizerRecord& record);
+        void RetireBucket(RecordBucket& bucket);
 
     private:
         std::deque<DeleteEntry> m_Queue;
+        std::vector<TimelineEntries> m_TimelineQueues;
+        u32 m_TimelineEntryCount = 0;
         std::mutex m_QueueLock;
+
+        // A record lives for as many iterations as a Push entry, so the ring needs two more buckets than that
+        // to never retire the bucket being pushed to
+        static constexpr u32 RecordBucketCount = Flourish::Context::MaxFrameBufferCount * 2 + 3;
+        std::array<RecordBucket, RecordBucketCount> m_RecordBuckets;
+        std::atomic<u32> m_PushBucket = 0;
+        u64 m_IterateCount = 0;
+        std::vector<VmaAllocation> m_RetiredAllocations;
+        std::mutex m_OverflowLock;
     };
 }
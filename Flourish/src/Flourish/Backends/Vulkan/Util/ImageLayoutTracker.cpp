@@ -0,0 +1,127 @@
+#include "flpch.h"
+#include "ImageLayoutTracker.h"
+
+#include "Flourish/Backends/Vulkan/Texture.h"
+#include "Flourish/Backends/Vulkan/Util/Synchronization.h"
+
+namespace Flourish::Vulkan
+{
+    static constexpr VkAccessFlags2KHR WriteAccessFlags =
+        VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR |
+        VK_ACCESS_2_SHADER_WRITE_BIT_KHR |
+        VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR |
+        VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR |
+        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR |
+        VK_ACCESS_2_MEMORY_WRITE_BIT_KHR;
+
+    void ImageLayoutTracker::Reset()
+    {
+        m_States.clear();
+        m_PendingBarriers.clear();
+    }
+
+    void ImageLayoutTracker::Require(
+        const Texture* texture,
+        u32 layerIndex,
+        u32 mipLevel,
+        VkImageLayout layout,
+        VkPipelineStageFlags2KHR stages,
+        VkAccessFlags2KHR access)
+    {
+        // Encoders only touch a handful of subresources, so a linear scan is enough
+        SubresourceState* state = nullptr;
+        for (auto& existing : m_States)
+        {
+            if (existing.Resource == texture && existing.LayerIndex == layerIndex && existing.MipLevel == mipLevel)
+            {
+                state = &existing;
+                break;
+            }
+        }
+
+        if (!state)
+        {
+            // Work before the encoder was synchronized by the graph, whose barrier covers the stages of the
+            // encoder's workload rather than the stages of this command (e.g. ALL_GRAPHICS for a blit). Starting
+            // from every stage chains any transition after that barrier regardless of which one it used
+            state = &m_States.emplace_back();
+            state->Resource = texture;
+            state->LayerIndex = layerIndex;
+            state->MipLevel = mipLevel;
+            state->Layout = texture->GetRestingLayout();
+            state->Stages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+            state->Access = 0;
+        }
+
+        bool layoutChange = state->Layout != layout;
+        bool hazard = (state->Access & WriteAccessFlags) || ((access & WriteAccessFlags) && state->Access);
+        if (!layoutChange && !hazard)
+        {
+            // Reads in the same layout do not need to wait on each other
+            state->Stages |= stages;
+            state->Access |= access;
+            return;
+        }
+
+        QueueBarrier(*state, layout, stages, access);
+        state->Layout = layout;
+        state->Stages = stages;
+        state->Access = access;
+    }
+
+    void ImageLayoutTracker::Flush(VkCommandBuffer buffer)
+    {
+        if (m_PendingBarriers.empty())
+            return;
+
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.imageMemoryBarrierCount = static_cast<u32>(m_PendingBarriers.size());
+        dependencyInfo.pImageMemoryBarriers = m_PendingBarriers.data();
+        Synchronization::PipelineBarrier(buffer, dependencyInfo);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
+
+        m_PendingBarriers.clear();
+    }
+
+    void ImageLayoutTracker::Restore(VkCommandBuffer buffer)
+    {
+        // Only the transition needs to be ordered here since the graph makes the writes visible to
+        // whatever consumes the texture next. The graph's barrier waits on the workload's stages, which
+        // need not include the stages used here, so the transition completes before every stage to chain into it
+        for (auto& state : m_States)
+        {
+            VkImageLayout restingLayout = state.Resource->GetRestingLayout();
+            if (state.Layout != restingLayout)
+                QueueBarrier(state, restingLayout, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR, 0);
+        }
+
+        Flush(buffer);
+        m_States.clear();
+    }
+
+    void ImageLayoutTracker::QueueBarrier(
+        const SubresourceState& state,
+        VkImageLayout newLayout,
+        VkPipelineStageFlags2KHR dstStages,
+        VkAccessFlags2KHR dstAccess)
+    {
+        auto& barrier = m_PendingBarriers.emplace_back();
+        barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+        barrier.srcStageMask = state.Stages;
+        barrier.srcAccessMask = state.Access & WriteAccessFlags;
+        barrier.dstStageMask = dstStages;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = state.Layout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = state.Resource->GetImage();
+        barrier.subresourceRange.aspectMask = state.Resource->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = state.MipLevel;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = state.LayerIndex;
+        barrier.subresourceRange.layerCount = 1;
+    }
+}
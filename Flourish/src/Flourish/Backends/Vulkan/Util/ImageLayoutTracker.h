@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Flourish/Backends/Vulkan/Util/Common.h"
+
+namespace Flourish::Vulkan
+{
+    // Tracks the layout and last access of each image subresource (layer / mip) touched by an encoder.
+    // Subresources enter and leave the encoder in their texture's resting layout, so a barrier is only
+    // recorded when a command needs a different layout or has to wait on an earlier command, and every
+    // subresource is restored in a single batched barrier once the encoder is done
+    class Texture;
+    class ImageLayoutTracker
+    {
+    public:
+        void Reset();
+
+        // Queues the barrier, if any, needed before the subresource is accessed in the given layout.
+        // Queued barriers are recorded together by Flush
+        void Require(
+            const Texture* texture,
+            u32 layerIndex,
+            u32 mipLevel,
+            VkImageLayout layout,
+            VkPipelineStageFlags2KHR stages,
+            VkAccessFlags2KHR access
+        );
+        void Flush(VkCommandBuffer buffer);
+
+        // Returns every tracked subresource to its resting layout and stops tracking it
+        void Restore(VkCommandBuffer buffer);
+
+    private:
+        struct SubresourceState
+        {
+            const Texture* Resource;
+            u32 LayerIndex;
+            u32 MipLevel;
+            VkImageLayout Layout;
+
+            // Accesses since the last barrier on this subresource
+            VkPipelineStageFlags2KHR Stages;
+            VkAccessFlags2KHR Access;
+        };
+
+    private:
+        void QueueBarrier(
+            const SubresourceState& state,
+            VkImageLayout newLayout,
+            VkPipelineStageFlags2KHR dstStages,
+            VkAccessFlags2KHR dstAccess
+        );
+
+    private:
+        std::vector<SubresourceState> m_States;
+        std::vector<VkImageMemoryBarrier2KHR> m_PendingBarriers;
+    };
+}
@@ -0,0 +1,112 @@
+#include "flpch.h"
+#include "MemoryTracker.h"
+
+#include "Flourish/Backends/Vulkan/Context.h"
+
+namespace Flourish::Vulkan
+{
+    void MemoryTracker::Initialize()
+    {
+        FL_LOG_TRACE("Vulkan memory tracker initialization begin");
+    }
+
+    void MemoryTracker::Shutdown()
+    {
+        FL_LOG_TRACE("Vulkan memory tracker shutdown begin");
+
+        for (auto& pair : m_LiveAllocations)
+        {
+            auto& info = pair.second;
+            FL_LOG_WARN(
+                "Leaked %s allocation '%s' (%llu bytes)",
+                MemoryCategoryToString(info.Category),
+                info.DebugName.empty() ? "unnamed" : info.DebugName.c_str(),
+                (unsigned long long)info.Size
+            );
+        }
+        m_LiveAllocations.clear();
+    }
+
+    void MemoryTracker::EndFrame()
+    {
+        std::lock_guard lock(m_Lock);
+
+        for (auto& category : m_Categories)
+        {
+            category.Stats.FrameAllocations = category.CurrentFrameAllocations;
+            category.Stats.FrameFrees = category.CurrentFrameFrees;
+            category.CurrentFrameAllocations = 0;
+            category.CurrentFrameFrees = 0;
+        }
+    }
+
+    void MemoryTracker::Track(VmaAllocation allocation, MemoryCategory category, std::string_view debugName)
+    {
+        if (!allocation) return;
+
+        VmaAllocationInfo allocInfo;
+        vmaGetAllocationInfo(Context::Allocator(), allocation, &allocInfo);
+
+        std::lock_guard lock(m_Lock);
+
+        m_LiveAllocations[allocation] = { category, allocInfo.size, std::string(debugName) };
+
+        auto& data = m_Categories[static_cast<u32>(category)];
+        data.Stats.AllocationCount++;
+        data.Stats.CurrentSize += allocInfo.size;
+        data.Stats.PeakSize = std::max(data.Stats.PeakSize, data.Stats.CurrentSize);
+        data.CurrentFrameAllocations++;
+    }
+
+    void MemoryTracker::Untrack(VmaAllocation allocation)
+    {
+        if (!allocation) return;
+
+        Untrack(&allocation, 1);
+    }
+
+    void MemoryTracker::Untrack(const VmaAllocation* allocations, u32 count)
+    {
+        std::lock_guard lock(m_Lock);
+
+        for (u32 i = 0; i < count; i++)
+        {
+            auto found = m_LiveAllocations.find(allocations[i]);
+            if (found == m_LiveAllocations.end())
+                continue;
+
+            auto& data = m_Categories[static_cast<u32>(found->second.Category)];
+            data.Stats.AllocationCount--;
+            data.Stats.CurrentSize -= found->second.Size;
+            data.CurrentFrameFrees++;
+
+            m_LiveAllocations.erase(found);
+        }
+    }
+
+    void MemoryTracker::PopulateStatistics(MemoryStatistics& stats)
+    {
+        std::lock_guard lock(m_Lock);
+
+        for (u32 i = 0; i < m_Categories.size(); i++)
+            stats.Categories[i] = m_Categories[i].Stats;
+    }
+
+    std::vector<MemoryAllocationInfo> MemoryTracker::GetLiveAllocations()
+    {
+        std::lock_guard lock(m_Lock);
+
+        std::vector<MemoryAllocationInfo> allocations;
+        allocations.reserve(m_LiveAllocations.size());
+        for (auto& pair : m_LiveAllocations)
+            allocations.emplace_back(pair.second);
+
+        // Largest first since this is mostly used to find what is eating memory
+        std::sort(allocations.begin(), allocations.end(), [](const auto& a, const auto& b)
+        {
+            return a.Size > b.Size;
+        });
+
+        return allocations;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Flourish/Backends/Vulkan/Util/Common.h"
+
+namespace Flourish::Vulkan
+{
+    class MemoryTracker
+    {
+    public:
+        void Initialize();
+        void Shutdown();
+
+        // Rolls the per frame churn counters
+        void EndFrame();
+
+        // TS
+        void Track(VmaAllocation allocation, MemoryCategory category, std::string_view debugName = {});
+        void Untrack(VmaAllocation allocation);
+        void Untrack(const VmaAllocation* allocations, u32 count);
+        void PopulateStatistics(MemoryStatistics& stats);
+        std::vector<MemoryAllocationInfo> GetLiveAllocations();
+
+    private:
+        struct CategoryData
+        {
+            MemoryCategoryStatistics Stats;
+            u32 CurrentFrameAllocations = 0;
+            u32 CurrentFrameFrees = 0;
+        };
+
+    private:
+        std::unordered_map<VmaAllocation, MemoryAllocationInfo> m_LiveAllocations;
+        std::array<CategoryData, static_cast<u32>(MemoryCategory::Count)> m_Categories;
+        std::mutex m_Lock;
+    };
+}
@@ -27,17 +27,30 @@ namespace Flourish::Vulkan
         for (auto& fam : uniqueFamilies)
         {
             auto& physical = m_PhysicalQueues[physicalIdx];
-            for (u32 i = 0; i < Flourish::Context::FrameBufferCount(); i++)
+            physical.Queues = std::vector<HardwareQueue>(fam.second);
+            for (u32 i = 0; i < fam.second; i++)
             {
                 vkGetDeviceQueue(
                     Context::Devices().Device(),
                     fam.first,
-                    i % fam.second,
-                    &physical.Queues[i]
+                    i,
+                    &physical.Queues[i].Queue
                 );
             }
 
+            // Frames use the first slots, so off-frame work starts after them to avoid contending with frames
+            // for as long as the family has queues to spare
             physical.QueueIndex = fam.first;
+            physical.NextThreadSlot = Flourish::Context::FrameBufferCount();
+
+            if (Context::Devices().SupportsTimelines())
+            {
+                for (auto& queue : physical.Queues)
+                {
+                    queue.Timeline = Synchronization::CreateTimelineSemaphore(0);
+                    queue.TimelineValue = 0;
+                }
+            }
 
             if (indices.GraphicsFamily.value() == fam.first)
                 m_VirtualQueues[static_cast<u32>(GPUWorkloadType::Graphics)] = physicalIdx;
@@ -54,6 +67,12 @@ namespace Flourish::Vulkan
         FL_LOG_DEBUG("Graphics workloads assigned to queue %d", m_VirtualQueues[static_cast<u32>(GPUWorkloadType::Graphics)]);
         FL_LOG_DEBUG("Compute workloads assigned to queue %d", m_VirtualQueues[static_cast<u32>(GPUWorkloadType::Compute)]);
         FL_LOG_DEBUG("Transfer workloads assigned to queue %d", m_VirtualQueues[static_cast<u32>(GPUWorkloadType::Transfer)]);
+        FL_LOG_DEBUG(
+            "Queue counts: graphics %d, compute %d, transfer %d",
+            QueueCount(GPUWorkloadType::Graphics),
+            QueueCount(GPUWorkloadType::Compute),
+            QueueCount(GPUWorkloadType::Transfer)
+        );
     }
 
     void Queues::Shutdown()
@@ -62,56 +81,50 @@ namespace Flourish::Vulkan
 
         for (auto fence : m_UnusedFences)
             vkDestroyFence(Context::Devices().Device(), fence, nullptr);
+
+        for (auto& physical : m_PhysicalQueues)
+        {
+            for (auto& queue : physical.Queues)
+            {
+                if (queue.Timeline)
+                    vkDestroySemaphore(Context::Devices().Device(), queue.Timeline, nullptr);
+                queue.Timeline = VK_NULL_HANDLE;
+            }
+        }
     }
     
-    VkFence Queues::PushCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer, std::function<void()> completionCallback, const char* debugName)
+    void Queues::PushCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer, std::function<void()> completionCallback, const char* debugName)
     {
-        VkFence fence = RetrieveFence();
-
-        VkSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &buffer;
-
-        Synchronization::ResetFences(&fence, 1);
-
-        LockQueue(workloadType, true);
-        FL_VK_ENSURE_RESULT(vkQueueSubmit(Queue(workloadType), 1, &submitInfo, fence), "PushCommand queue submit");
-        LockQueue(workloadType, false);
+        CommandSyncPoint syncPoint = SubmitCommand(workloadType, buffer);
 
-        Context::FinalizerQueue().PushAsync([this, completionCallback, fence]()
-        {
-            m_FencesLock.lock();
-            m_UnusedFences.push_back(fence);
-            m_FencesLock.unlock();
-
-            if (completionCallback)
-                completionCallback();
-        }, &fence, 1, debugName);
-        
-        return fence;
+        FinalizeCommand(syncPoint, completionCallback, debugName);
     }
 
     void Queues::ExecuteCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer, const char* debugName)
     {
-        VkFence pushFence = PushCommand(workloadType, buffer, nullptr, debugName);
-        
-        Synchronization::WaitForFences(&pushFence, 1);
+        CommandSyncPoint syncPoint = SubmitCommand(workloadType, buffer);
+
+        FinalizeCommand(syncPoint, nullptr, debugName);
+
+        if (syncPoint.Fence)
+            Synchronization::WaitForFences(&syncPoint.Fence, 1);
+        else
+            Synchronization::WaitForSemaphore(syncPoint.Semaphore, syncPoint.Value);
     }
 
     VkQueue Queues::PresentQueue() const
     {
-        return m_PhysicalQueues[m_PresentQueue].Queues[Flourish::Context::FrameIndex()];
+        return GetHardwareQueue(m_PhysicalQueues[m_PresentQueue], Flourish::Context::FrameIndex()).Queue;
     }
 
-    VkQueue Queues::Queue(GPUWorkloadType workloadType, u32 frameIndex) const
+    VkQueue Queues::Queue(GPUWorkloadType workloadType, u32 queueSlot) const
     {
-        return GetQueueData(workloadType).Queues[frameIndex];
+        return GetHardwareQueue(GetQueueData(workloadType), queueSlot).Queue;
     }
 
-    void Queues::LockQueue(GPUWorkloadType workloadType, bool lock)
+    void Queues::LockQueue(GPUWorkloadType workloadType, bool lock, u32 queueSlot)
     {
-        std::mutex* mutex = &GetQueueData(workloadType).AccessMutex;
+        std::mutex* mutex = &GetHardwareQueue(GetQueueData(workloadType), queueSlot).AccessMutex;
         if (lock)
             mutex->lock();
         else
@@ -120,7 +133,7 @@ namespace Flourish::Vulkan
 
     void Queues::LockPresentQueue(bool lock)
     {
-        std::mutex* mutex = &m_PhysicalQueues[m_PresentQueue].AccessMutex;
+        std::mutex* mutex = &GetHardwareQueue(m_PhysicalQueues[m_PresentQueue], Flourish::Context::FrameIndex()).AccessMutex;
         if (lock)
             mutex->lock();
         else
@@ -132,6 +145,24 @@ namespace Flourish::Vulkan
         return GetQueueData(workloadType).QueueIndex;
     }
 
+    u32 Queues::QueueCount(GPUWorkloadType workloadType) const
+    {
+        return static_cast<u32>(GetQueueData(workloadType).Queues.size());
+    }
+
+    u32 Queues::ThreadQueueSlot(GPUWorkloadType workloadType)
+    {
+        // Slots are kept per queue rather than per workload so that workloads sharing a queue also share the slot
+        thread_local static std::array<u32, 4> threadSlots = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+
+        u32 physicalIdx = m_VirtualQueues[static_cast<u32>(workloadType)];
+        u32& slot = threadSlots[physicalIdx];
+        if (slot == UINT32_MAX)
+            slot = m_PhysicalQueues[physicalIdx].NextThreadSlot++;
+
+        return slot;
+    }
+
     QueueFamilyIndices Queues::GetQueueFamilies(VkPhysicalDevice device)
     {
         QueueFamilyIndices indices;
@@ -164,16 +195,24 @@ namespace Flourish::Vulkan
             indices.TransferQueueCount = family.queueCount;
 
             VkBool32 presentSupport = false;
-            #ifdef FL_PLATFORM_WINDOWS
-                presentSupport = vkGetPhysicalDeviceWin32PresentationSupportKHR(device, i);
-            #elif defined(FL_PLATFORM_LINUX)
-                // TODO: we need to figure out where these params come from
-                // presentSupport = vkGetPhysicalDeviceXcbPresentationSupportKHR(device, i, ???, ???);
-                presentSupport = true;
-            #else
-                // Doesn't seem to be any function to verify, so it should always be true
+            if (Flourish::Context::Headless())
+            {
+                // Nothing is ever presented, so the present queue just aliases the graphics queue
                 presentSupport = family.queueFlags & VK_QUEUE_GRAPHICS_BIT;
-            #endif
+            }
+            else
+            {
+                #ifdef FL_PLATFORM_WINDOWS
+                    presentSupport = vkGetPhysicalDeviceWin32PresentationSupportKHR(device, i);
+                #elif defined(FL_PLATFORM_LINUX)
+                    // TODO: we need to figure out where these params come from
+                    // presentSupport = vkGetPhysicalDeviceXcbPresentationSupportKHR(device, i, ???, ???);
+                    presentSupport = true;
+                #else
+                    // Doesn't seem to be any function to verify, so it should always be true
+                    presentSupport = family.queueFlags & VK_QUEUE_GRAPHICS_BIT;
+                #endif
+            }
 
             if (presentSupport)
             {
@@ -217,6 +256,79 @@ namespace Flourish::Vulkan
         return m_PhysicalQueues[m_VirtualQueues[static_cast<u32>(workloadType)]];
     }
 
+    Queues::HardwareQueue& Queues::GetHardwareQueue(QueueData& data, u32 queueSlot)
+    {
+        return data.Queues[queueSlot % data.Queues.size()];
+    }
+
+    const Queues::HardwareQueue& Queues::GetHardwareQueue(const QueueData& data, u32 queueSlot) const
+    {
+        return data.Queues[queueSlot % data.Queues.size()];
+    }
+
+    Queues::CommandSyncPoint Queues::SubmitCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer)
+    {
+        CommandSyncPoint syncPoint;
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &buffer;
+
+        u32 queueSlot = ThreadQueueSlot(workloadType);
+        HardwareQueue& queue = GetHardwareQueue(GetQueueData(workloadType), queueSlot);
+        if (queue.Timeline)
+        {
+            VkTimelineSemaphoreSubmitInfo timelineSubmitInfo{};
+            timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineSubmitInfo.signalSemaphoreValueCount = 1;
+            timelineSubmitInfo.pSignalSemaphoreValues = &syncPoint.Value;
+            submitInfo.pNext = &timelineSubmitInfo;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &queue.Timeline;
+            syncPoint.Semaphore = queue.Timeline;
+
+            // Values must be signalled in increasing order, so they are assigned while the queue is locked
+            queue.AccessMutex.lock();
+            syncPoint.Value = ++queue.TimelineValue;
+            FL_VK_ENSURE_RESULT(Synchronization::QueueSubmit(queue.Queue, submitInfo, VK_NULL_HANDLE), "PushCommand queue submit");
+            queue.AccessMutex.unlock();
+        }
+        else
+        {
+            syncPoint.Fence = RetrieveFence();
+            Synchronization::ResetFences(&syncPoint.Fence, 1);
+
+            queue.AccessMutex.lock();
+            FL_VK_ENSURE_RESULT(Synchronization::QueueSubmit(queue.Queue, submitInfo, syncPoint.Fence), "PushCommand queue submit");
+            queue.AccessMutex.unlock();
+        }
+        Flourish::Context::IncrementFrameCounter(FrameCounter::QueueSubmits);
+
+        return syncPoint;
+    }
+
+    void Queues::FinalizeCommand(const CommandSyncPoint& syncPoint, std::function<void()> completionCallback, const char* debugName)
+    {
+        if (!syncPoint.Fence)
+        {
+            if (completionCallback)
+                Context::FinalizerQueue().PushAsync(completionCallback, syncPoint.Semaphore, syncPoint.Value, debugName);
+            return;
+        }
+
+        VkFence fence = syncPoint.Fence;
+        Context::FinalizerQueue().PushAsync([this, completionCallback, fence]()
+        {
+            m_FencesLock.lock();
+            m_UnusedFences.push_back(fence);
+            m_FencesLock.unlock();
+
+            if (completionCallback)
+                completionCallback();
+        }, &fence, 1, debugName);
+    }
+
     VkFence Queues::RetrieveFence()
     {
         m_FencesLock.lock();
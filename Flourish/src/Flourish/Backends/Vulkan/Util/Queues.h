@@ -35,7 +35,9 @@ namespace Flourish::Vulkan
         void Shutdown();
 
         // TS
-        VkFence PushCommand(
+        // Completion is tracked through the queue's timeline semaphore when timelines are supported, and through
+        // a pooled fence otherwise
+        void PushCommand(
             GPUWorkloadType workloadType,
             VkCommandBuffer buffer,
             std::function<void()> completionCallback = nullptr,
@@ -44,12 +46,20 @@ namespace Flourish::Vulkan
         void ExecuteCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer, const char* debugName = nullptr);
 
         // TS
+        // Each family exposes every queue it advertises. A queue is selected by a slot which wraps around the
+        // family's queue count, so frame work passes its frame index and other work passes its thread's slot
         VkQueue PresentQueue() const;
-        VkQueue Queue(GPUWorkloadType workloadType, u32 frameIndex = Flourish::Context::FrameIndex()) const;
-        void LockQueue(GPUWorkloadType workloadType, bool lock);
+        VkQueue Queue(GPUWorkloadType workloadType, u32 queueSlot = Flourish::Context::FrameIndex()) const;
+        void LockQueue(GPUWorkloadType workloadType, bool lock, u32 queueSlot = Flourish::Context::FrameIndex());
         void LockPresentQueue(bool lock);
         inline u32 PresentQueueIndex() const { return m_PhysicalQueues[m_PresentQueue].QueueIndex; }
         u32 QueueIndex(GPUWorkloadType workloadType) const;
+        u32 QueueCount(GPUWorkloadType workloadType) const;
+
+        // TS
+        // Slot used by the calling thread for work outside of the frame. Slots are handed out round-robin the first
+        // time a thread submits, so concurrent threads spread over the family while each thread's work stays in order
+        u32 ThreadQueueSlot(GPUWorkloadType workloadType);
 
     public:
         // TS
@@ -69,16 +79,38 @@ namespace Flourish::Vulkan
             bool Submitted = false;
         };
 
+        struct HardwareQueue
+        {
+            VkQueue Queue;
+            std::mutex AccessMutex;
+
+            // Signalled by PushCommand submissions, incremented under AccessMutex so values complete in order
+            VkSemaphore Timeline = VK_NULL_HANDLE;
+            u64 TimelineValue = 0;
+        };
+
+        // What a command submission signals. Either the fence or the timeline pair is set
+        struct CommandSyncPoint
+        {
+            VkFence Fence = VK_NULL_HANDLE;
+            VkSemaphore Semaphore = VK_NULL_HANDLE;
+            u64 Value = 0;
+        };
+
         struct QueueData
         {
-            std::array<VkQueue, Flourish::Context::MaxFrameBufferCount> Queues;
+            std::vector<HardwareQueue> Queues;
             u32 QueueIndex;
-            std::mutex AccessMutex;
+            std::atomic<u32> NextThreadSlot = 0;
         };
 
     private:
         QueueData& GetQueueData(GPUWorkloadType workloadType);
         const QueueData& GetQueueData(GPUWorkloadType workloadType) const;
+        HardwareQueue& GetHardwareQueue(QueueData& data, u32 queueSlot);
+        const HardwareQueue& GetHardwareQueue(const QueueData& data, u32 queueSlot) const;
+        CommandSyncPoint SubmitCommand(GPUWorkloadType workloadType, VkCommandBuffer buffer);
+        void FinalizeCommand(const CommandSyncPoint& syncPoint, std::function<void()> completionCallback, const char* debugName);
         VkFence RetrieveFence();
 
     private:
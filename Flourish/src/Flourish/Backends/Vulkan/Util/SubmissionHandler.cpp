@@ -5,18 +5,36 @@
 #include "Flourish/Backends/Vulkan/RenderContext.h"
 #include "Flourish/Backends/Vulkan/CommandBuffer.h"
 #include "Flourish/Backends/Vulkan/RenderGraph.h"
+#include "Flourish/Backends/Vulkan/Buffer.h"
+#include "Flourish/Backends/Vulkan/Texture.h"
 #include "Flourish/Backends/Vulkan/Util/Synchronization.h"
 
+#include <chrono>
+
 namespace Flourish::Vulkan
 {
-    void SubmissionHandler::Initialize()
+    void SubmissionHandler::Initialize(const ContextInitializeInfo& initInfo)
     {
         FL_LOG_TRACE("Vulkan submission handler initialization begin");
+
+        m_SubmissionThreadStopping = false;
+        if (initInfo.DedicatedSubmissionThread)
+            m_SubmissionThread = std::thread(&SubmissionHandler::SubmissionThreadLoop, this);
     }
     
     void SubmissionHandler::Shutdown()
     {
+        if (!m_SubmissionThread.joinable())
+            return;
+
+        {
+            std::lock_guard lock(m_SubmissionThreadLock);
+            m_SubmissionThreadStopping = true;
+        }
+        m_SubmissionThreadCondition.notify_all();
 
+        // The thread's command pools are handed back to Commands on exit, so this must happen before it shuts down
+        m_SubmissionThread.join();
     }
 
     void SubmissionHandler::WaitOnFrameSemaphores()
@@ -29,6 +47,10 @@ namespace Flourish::Vulkan
         
         Synchronization::WaitForFences(fences.data(), fences.size());
 
+        // Frame resource accesses from this frame index are complete now, so they can be dropped
+        if (m_FrameResources.size() > m_FrameResourcePruneSize)
+            PruneFrameResources();
+
         fences.clear();
         sems.clear();
         vals.clear();
@@ -68,13 +90,53 @@ namespace Flourish::Vulkan
         for (Flourish::RenderContext* _context : Flourish::Context::FrameContextSubmissions())
         {
             auto context = static_cast<RenderContext*>(_context);
-            if (!context->Swapchain().IsValid())
-                continue;
+            if (context->Swapchain().IsValid())
+                PresentContext(context);
 
-            PresentContext(context);
+            // Reads are declared per frame
+            context->ClearFrameReads();
         }
     }
 
+    void SubmissionHandler::QueueFrameSubmissions()
+    {
+        if (!m_SubmissionThread.joinable())
+        {
+            ProcessFrameSubmissions();
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_SubmissionThreadLock);
+            m_FrameSubmissionPending = true;
+        }
+        m_SubmissionThreadCondition.notify_all();
+    }
+
+    void SubmissionHandler::WaitOnFrameSubmissions()
+    {
+        FL_PROFILE_FUNCTION();
+
+        WaitOnSubmissionThread();
+
+        std::lock_guard lock(m_SubmissionThreadLock);
+        if (m_SubmissionThreadError)
+        {
+            std::exception_ptr error = m_SubmissionThreadError;
+            m_SubmissionThreadError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void SubmissionHandler::WaitOnSubmissionThread()
+    {
+        if (!m_SubmissionThread.joinable() || std::this_thread::get_id() == m_SubmissionThread.get_id())
+            return;
+
+        std::unique_lock lock(m_SubmissionThreadLock);
+        m_SubmissionThreadCondition.wait(lock, [this]() { return !m_FrameSubmissionPending; });
+    }
+
     void SubmissionHandler::ProcessPushSubmission(Flourish::RenderGraph* graph, std::function<void()> callback)
     {
         /*
@@ -118,195 +180,279 @@ namespace Flourish::Vulkan
     void SubmissionHandler::ProcessGraph(
         RenderGraph* graph,
         bool frameScope,
-        std::function<void(VkSubmitInfo&, VkTimelineSemaphoreSubmitInfo&)>&& preSubmitCallback)
+        std::function<void(int, VkSubmitInfo&, VkTimelineSemaphoreSubmitInfo&)>&& preSubmitCallback)
     {
+        FL_PROFILE_FUNCTION();
+
         auto& executeData = graph->GetExecutionData();
         u32 frameIndex = graph->GetExecutionFrameIndex();
 
-        VkCommandBufferBeginInfo cmdBeginInfo{};
-        cmdBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        cmdBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        bool batchSubmits = ShouldBatchSubmits(frameScope);
+
+        // Recording is timed alongside the GPU timestamps so that both can be inspected per node
+        bool timeRecording = frameScope && Context::Timestamps().IsEnabled();
+
+        // Reused across calls so that processing does not allocate every frame
+        thread_local static std::vector<RecordTask> tasks;
+        thread_local static std::vector<RecordEncoder> encoders;
+        tasks.clear();
+        encoders.clear();
 
+        // Split the encoders into the primary buffers they are recorded into. Everything a primary buffer needs was
+        // resolved when the graph was built, so each one can be recorded on its own
         u32 totalIndex = 0;
-        int nextSubmit = -1;
-        VkCommandBuffer primaryBuf;
-        CommandBufferAllocInfo lastAlloc;
-        for (u32 orderIndex = 0; orderIndex <= executeData.SubmissionOrder.size(); orderIndex++)
+        for (u32 orderIndex = 0; orderIndex < executeData.SubmissionOrder.size(); orderIndex++)
         {
-            bool finalIteration = orderIndex == executeData.SubmissionOrder.size();
-            const RenderGraphNode& node = graph->GetNode(executeData.SubmissionOrder[finalIteration ? 0 : orderIndex]);
-            CommandBuffer* buffer = static_cast<CommandBuffer*>(node.Buffer);
-            auto& submissions = buffer->GetEncoderSubmissions();
-            bool resetQueryPool = false;
+            const RenderGraphNodeData& node = graph->GetNode(executeData.SubmissionOrder[orderIndex]);
+            auto& submissions = static_cast<CommandBuffer*>(node.Buffer)->GetEncoderSubmissions();
             FL_ASSERT(
-                finalIteration || submissions.size() == node.EncoderNodes.size(),
+                submissions.size() == node.EncoderCount,
                 "Command buffer submission count (%d) differs from specified size in render graph (%d)",
-                submissions.size(), node.EncoderNodes.size()
+                submissions.size(), node.EncoderCount
             );
-            for (u32 subIndex = 0; subIndex < submissions.size() || finalIteration; subIndex++)
-            {
-                // We want to iterate for each submission, but also once more for the 'final iteration' so that we can
-                // end/submit the command buffer without having to duplicate the code
 
-                bool shouldSubmitBuffer = finalIteration || executeData.SubmissionSyncs[totalIndex].SubmitDataIndex != -1;
-                if (shouldSubmitBuffer)
+            bool resetQueryPool = false;
+            for (u32 subIndex = 0; subIndex < submissions.size(); subIndex++)
+            {
+                int submitIndex = executeData.SubmissionSyncs[totalIndex].SubmitDataIndex;
+                if (submitIndex != -1)
                 {
-                    // If this is the final iteration or the current buffer is marked as submittable, we want to begin the
-                    // command buffer that we will eventually submit
-
-                    if (nextSubmit != -1)
-                    {
-                        // If we are currently processing a command buffer, we want to end it and submit it before processing the
-                        // new one
-
-                        auto& submitData = executeData.SubmitData[executeData.SubmissionSyncs[nextSubmit].SubmitDataIndex];
-
-                        vkEndCommandBuffer(primaryBuf);
-
-                        VkSubmitInfo submitInfo = submitData.SubmitInfos[frameIndex];
-                        submitInfo.pCommandBuffers = &primaryBuf;
-                        VkTimelineSemaphoreSubmitInfo timelineSubmitInfo = submitData.TimelineSubmitInfo;
-
-                        // Run the pre-submit callback. This exists due to differing behavior between synchronization modes. Essentially
-                        // all of the graph execution logic is identical, but how each mode handles wait and signal semaphores differ,
-                        // so we allow that flexibility here
-                        preSubmitCallback(submitInfo, timelineSubmitInfo);
-
-                        if (Context::Devices().SupportsTimelines())
-                            submitInfo.pNext = &timelineSubmitInfo;
-
-                        VkFence fence = submitData.SignalFences[frameIndex];
-                        Synchronization::ResetFences(&fence, 1);
-
-                        Context::Queues().LockQueue(submitData.Workload, true);
-                        FL_VK_ENSURE_RESULT(vkQueueSubmit(
-                            Context::Queues().Queue(submitData.Workload),
-                            1, &submitInfo, fence
-                        ), "Submission handler submit");
-                        Context::Queues().LockQueue(submitData.Workload, false);
-
-                        if (!frameScope)
-                        {
-                            // If the buffer is not within the frame scope, we need to add a finalizer which will free this individual
-                            // command buffer once the commands finish executing. Frame command buffers have their pools entirely reset at once
-
-                            Context::FinalizerQueue().PushAsync([lastAlloc, primaryBuf]()
-                            {
-                                Context::Commands().FreeBuffer(lastAlloc, primaryBuf);
-                            }, &fence, 1, "Submission free primary buffer");
-                        }
-                    }
-
-                    if (finalIteration)
-                        break;
-
-                    // Begin the next command buffer to process. We only need to do this if there are more things to process (i.e.
-                    // finalIteration is false)
-
-                    lastAlloc = Context::Commands().AllocateBuffers(
-                        submissions[subIndex].AllocInfo.WorkloadType,
-                        false,
-                        &primaryBuf, 1,
-                        !frameScope
-                    );   
-                    
-                    vkBeginCommandBuffer(primaryBuf, &cmdBeginInfo);
-
-                    nextSubmit = totalIndex;
+                    auto& task = tasks.emplace_back();
+                    task.SubmitIndex = submitIndex;
+                    task.EncoderOffset = static_cast<u32>(encoders.size());
+                    task.Workload = submissions[subIndex].AllocInfo.WorkloadType;
                 }
+                tasks.back().EncoderCount++;
+
+                auto& encoder = encoders.emplace_back();
+                encoder.OrderIndex = orderIndex;
+                encoder.SubIndex = subIndex;
+                encoder.SyncIndex = totalIndex;
+
+                // Reset the command buffer's query pool before executing any of its commands. This will noop if the
+                // buffer has no pools allocated. Query pool ops are not supported on the transfer queue
+                encoder.ResetQueryPool = !resetQueryPool && submissions[subIndex].AllocInfo.WorkloadType != GPUWorkloadType::Transfer;
+                resetQueryPool |= encoder.ResetQueryPool;
+
+                totalIndex++;
+            }
+        }
+
+        // Frame primary buffers come from per-thread pools that are reset at once, so they can be recorded by the
+        // workers. Other submissions are recorded here to keep their persistent buffers on this thread
+        const auto recordTask = [&](u32 taskIndex)
+        {
+            RecordSubmission(graph, frameScope, timeRecording, tasks[taskIndex], encoders.data());
+        };
+        if (frameScope && encoders.size() >= MinParallelRecordEncoders)
+            Context::Workers().Run(static_cast<u32>(tasks.size()), recordTask);
+        else
+        {
+            for (u32 i = 0; i < tasks.size(); i++)
+                recordTask(i);
+        }
+
+        // Submission order still follows the graph
+        for (auto& task : tasks)
+        {
+            auto& submitData = executeData.SubmitData[task.SubmitIndex];
 
-                auto& syncInfo = executeData.SubmissionSyncs[totalIndex];
-                auto& submission = submissions[subIndex];
+            VkSubmitInfo submitInfo = submitData.SubmitInfos[frameIndex];
+            submitInfo.pCommandBuffers = &task.Buffer;
+            VkTimelineSemaphoreSubmitInfo timelineSubmitInfo = submitData.TimelineSubmitInfo;
 
-                FL_ASSERT(
-                    submission.AllocInfo.WorkloadType == node.EncoderNodes[subIndex].WorkloadType,
-                    "Command buffer submission type is different than specified in the graph"
+            // Run the pre-submit callback. This exists due to differing behavior between synchronization modes. Essentially
+            // all of the graph execution logic is identical, but how each mode handles wait and signal semaphores differ,
+            // so we allow that flexibility here
+            preSubmitCallback(task.SubmitIndex, submitInfo, timelineSubmitInfo);
+
+            if (batchSubmits)
+            {
+                QueueBatchedSubmit(
+                    submitData.Workload,
+                    submitInfo, timelineSubmitInfo,
+                    task.Buffer,
+                    submitData.IsCompletion ? submitData.SignalFences[frameIndex] : VK_NULL_HANDLE
                 );
+                continue;
+            }
 
-                // Reset the command buffer's query pool before executing any of its commands. This
-                // will noop if the buffer has no pools allocated. Query pool ops are not supported
-                // on the transfer queue
-                if (!resetQueryPool && submission.AllocInfo.WorkloadType != GPUWorkloadType::Transfer)
-                {
-                    buffer->ResetQueryPool(primaryBuf);
-                    resetQueryPool = true;
-                }
+            if (Context::Devices().SupportsTimelines())
+                submitInfo.pNext = &timelineSubmitInfo;
+
+            VkFence fence = submitData.SignalFences[frameIndex];
+            Synchronization::ResetFences(&fence, 1);
+
+            // Frame graphs stay on their frame's queue. Other graphs go to the submitting thread's queue so that graphs
+            // pushed from different threads do not contend, while each graph's submissions still share one queue
+            u32 queueSlot = frameScope
+                ? Flourish::Context::FrameIndex()
+                : Context::Queues().ThreadQueueSlot(submitData.Workload);
+            Context::Queues().LockQueue(submitData.Workload, true, queueSlot);
+            FL_VK_ENSURE_RESULT(Synchronization::QueueSubmit(
+                Context::Queues().Queue(submitData.Workload, queueSlot),
+                submitInfo, fence
+            ), "Submission handler submit");
+            Context::Queues().LockQueue(submitData.Workload, false, queueSlot);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::QueueSubmits);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::SemaphoresWaited, submitInfo.waitSemaphoreCount);
+
+            if (frameScope)
+                continue;
+
+            // If the buffers are not within the frame scope, we need to add finalizers which will free them once the commands
+            // finish executing. Frame command buffers have their pools entirely reset at once
+            Context::FinalizerQueue().PushAsync([allocInfo = task.AllocInfo, primaryBuf = task.Buffer]()
+            {
+                Context::Commands().FreeBuffer(allocInfo, primaryBuf);
+            }, &fence, 1, "Submission free primary buffer");
+
+            for (u32 i = task.EncoderOffset; i < task.EncoderOffset + task.EncoderCount; i++)
+            {
+                const RenderGraphNodeData& node = graph->GetNode(executeData.SubmissionOrder[encoders[i].OrderIndex]);
+                auto& submission = static_cast<CommandBuffer*>(node.Buffer)->GetEncoderSubmissions()[encoders[i].SubIndex];
+                if (submission.Buffers.empty())
+                    continue;
 
-                if (syncInfo.Barrier.ShouldBarrier)
+                Context::FinalizerQueue().PushAsync([submission]()
                 {
-                    // If we've determined a barrier should be here during the graph build process, insert it
-
-                    vkCmdPipelineBarrier(
-                        primaryBuf,
-                        syncInfo.Barrier.SrcStage,
-                        syncInfo.Barrier.DstStage,
-                        0,
-                        1, &syncInfo.Barrier.MemoryBarrier,
-                        0, nullptr,
-                        0, nullptr
+                    Context::Commands().FreeBuffers(
+                        submission.AllocInfo,
+                        submission.Buffers.data(),
+                        submission.Buffers.size()
                     );
-                }
+                }, &submitData.SignalFences[frameIndex], 1, "Submission free secondary buffers");
+            }
+        }
 
-                 // For debugging
-                /*
-                VkMemoryBarrier barrier{};
-                barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-                barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
-                barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
-                vkCmdPipelineBarrier(
-                    primaryBuf,
-                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                    0,
-                    1, &barrier,
-                    0, nullptr,
-                    0, nullptr
-                );
-                */
+        // Cleanup the submissions once we've processed them so that they cannot be re-processed
+        u32 encoderIndex = 0;
+        for (u32 orderIndex = 0; orderIndex < executeData.SubmissionOrder.size(); orderIndex++)
+        {
+            const RenderGraphNodeData& node = graph->GetNode(executeData.SubmissionOrder[orderIndex]);
+            static_cast<CommandBuffer*>(node.Buffer)->ClearSubmissions();
+
+            d64 recordTime = 0.0;
+            for (; encoderIndex < encoders.size() && encoders[encoderIndex].OrderIndex == orderIndex; encoderIndex++)
+                recordTime += encoders[encoderIndex].RecordTime;
+            if (timeRecording)
+                graph->StoreRecordTime(node.Id, recordTime);
+        }
+    }
+
+    void SubmissionHandler::RecordSubmission(
+        RenderGraph* graph,
+        bool frameScope,
+        bool timeRecording,
+        RecordTask& task,
+        RecordEncoder* encoders)
+    {
+        FL_PROFILE_FUNCTION();
+
+        auto& executeData = graph->GetExecutionData();
+        u32 frameIndex = graph->GetExecutionFrameIndex();
+
+        VkCommandBufferBeginInfo cmdBeginInfo{};
+        cmdBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        cmdBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        VkMemoryBarrier2KHR memoryBarrier;
+        VkDependencyInfoKHR dependencyInfo;
+
+        task.AllocInfo = Context::Commands().AllocateBuffers(
+            task.Workload,
+            false,
+            &task.Buffer, 1,
+            !frameScope
+        );
+        vkBeginCommandBuffer(task.Buffer, &cmdBeginInfo);
+
+        for (u32 i = task.EncoderOffset; i < task.EncoderOffset + task.EncoderCount; i++)
+        {
+            auto& encoder = encoders[i];
+            auto recordStart = timeRecording ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+            const RenderGraphNodeData& node = graph->GetNode(executeData.SubmissionOrder[encoder.OrderIndex]);
+            CommandBuffer* buffer = static_cast<CommandBuffer*>(node.Buffer);
+            auto& syncInfo = executeData.SubmissionSyncs[encoder.SyncIndex];
+            auto& submission = buffer->GetEncoderSubmissions()[encoder.SubIndex];
 
-                if (!submission.Buffers.empty())
+            FL_ASSERT(
+                submission.AllocInfo.WorkloadType == graph->GetEncoder(node, encoder.SubIndex).WorkloadType,
+                "Command buffer submission type is different than specified in the graph"
+            );
+
+            if (encoder.ResetQueryPool)
+                buffer->ResetQueryPool(task.Buffer);
+
+            // Wait on the second half of any split barriers. Events are reset right away so that they can be set again
+            // the next time the graph executes. Both halves resolve to the same dependency as they are recorded together
+            for (u32 j = syncInfo.SplitWaitOffset; j < syncInfo.SplitWaitOffset + syncInfo.SplitWaitCount; j++)
+            {
+                auto& split = executeData.SplitBarriers[j];
+                ResolveGraphBarrier(executeData, split.Barrier, memoryBarrier, dependencyInfo);
+                Synchronization::WaitEvent(task.Buffer, split.Events[frameIndex], dependencyInfo);
+                Synchronization::ResetEvent(task.Buffer, split.Events[frameIndex]);
+                Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
+            }
+
+            if (syncInfo.Barrier.ShouldBarrier)
+            {
+                // If we've determined a barrier should be here during the graph build process, insert it
+                RecordGraphBarrier(task.Buffer, executeData, syncInfo.Barrier);
+                Flourish::Context::IncrementFrameCounter(FrameCounter::PipelineBarriers);
+            }
+
+            // Bracket the encoder with timestamps if enabled. Only frame submissions are timed since their
+            // completion is guaranteed by the time the frame index comes back around
+            TimestampAllocation timestamp;
+            bool writeTimestamps = frameScope &&
+                submission.AllocInfo.WorkloadType != GPUWorkloadType::Transfer &&
+                Context::Timestamps().Allocate(graph, node.Id, encoder.SubIndex, timestamp);
+            if (writeTimestamps)
+            {
+                vkCmdResetQueryPool(task.Buffer, timestamp.Pool, timestamp.Index, 2);
+                vkCmdWriteTimestamp(task.Buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamp.Pool, timestamp.Index);
+            }
+
+            if (!submission.Buffers.empty())
+            {
+                if (submission.Framebuffer)
                 {
-                    if (submission.Framebuffer)
-                    {
-                        // If the submission has a framebuffer, this indicates the following commands are associated with a renderpass,
-                        // so we must specifically handle all of the pass/subpass logic
-
-                        ExecuteRenderPassCommands(
-                            primaryBuf,
-                            submission.Framebuffer,
-                            submission.Buffers.data(),
-                            submission.Buffers.size()
-                        );
-                    }
-                    else
-                        // Otherwise we can just execute the commands normally
-                        vkCmdExecuteCommands(primaryBuf, 1, &submission.Buffers[0]);
-
-                    if (!frameScope)
-                    {
-                        // Like before, if this submission is not frame scoped, we must manually free all of the buffers. Here,
-                        // we are freeing the secondary buffers rather than the primary.
-
-                        auto& submitData = executeData.SubmitData[executeData.SubmissionSyncs[nextSubmit].SubmitDataIndex];
-                        auto& submitInfo = submitData.SubmitInfos[frameIndex];
-
-                        Context::FinalizerQueue().PushAsync([submission]()
-                        {
-                            Context::Commands().FreeBuffers(
-                                submission.AllocInfo,
-                                submission.Buffers.data(),
-                                submission.Buffers.size()
-                            );
-                        }, &submitData.SignalFences[frameIndex], 1, "Submission free secondary buffers");
-                    }
+                    // If the submission has a framebuffer, this indicates the following commands are associated with a renderpass,
+                    // so we must specifically handle all of the pass/subpass logic
+
+                    ExecuteRenderPassCommands(
+                        task.Buffer,
+                        submission.Framebuffer,
+                        submission.Buffers.data(),
+                        submission.Buffers.size()
+                    );
                 }
+                else
+                    // Otherwise we can just execute the commands normally
+                    vkCmdExecuteCommands(task.Buffer, 1, &submission.Buffers[0]);
+            }
 
-                totalIndex++;
+            if (writeTimestamps)
+                vkCmdWriteTimestamp(task.Buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamp.Pool, timestamp.Index + 1);
+
+            // Signal the split barriers produced by this encoder
+            for (u32 j = syncInfo.SplitSetOffset; j < syncInfo.SplitSetOffset + syncInfo.SplitSetCount; j++)
+            {
+                auto& split = executeData.SplitBarriers[executeData.SplitBarrierSets[j]];
+                ResolveGraphBarrier(executeData, split.Barrier, memoryBarrier, dependencyInfo);
+                Synchronization::SetEvent(task.Buffer, split.Events[frameIndex], dependencyInfo);
             }
 
-            // Cleanup the submissions once we've processed them so that they cannot be re-processed
-            buffer->ClearSubmissions();
+            if (timeRecording)
+            {
+                encoder.RecordTime = static_cast<d64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - recordStart
+                ).count());
+            }
         }
+
+        vkEndCommandBuffer(task.Buffer);
     }
 
     void SubmissionHandler::ProcessSubmission(
@@ -322,6 +468,20 @@ namespace Flourish::Vulkan
         // TODO: this whole system is not great, but for now we need all of them to be passed in
         FL_ASSERT(finalFences && finalSemaphores && finalSemaphoreValues);
 
+        bool batchSubmits = ShouldBatchSubmits(frameScope);
+        if (batchSubmits)
+        {
+            // Batched root submissions point into the wait flags until they are flushed, so size them up front
+            // to keep them from reallocating
+            u32 lastFrameIndex = Flourish::Context::LastFrameIndex();
+            if (m_FrameWaitFlags.size() < m_FrameWaitSemaphores[lastFrameIndex].size())
+                m_FrameWaitFlags.resize(m_FrameWaitSemaphores[lastFrameIndex].size(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+        }
+
+        // Submissions using these were all made by the last call in the frame scope
+        if (frameScope)
+            m_FrameResourceWaitCount = 0;
+
         for (u32 graphIdx = 0; graphIdx < graphCount; graphIdx++)
         {
             auto graph = static_cast<RenderGraph*>(graphs[graphIdx]);
@@ -332,24 +492,144 @@ namespace Flourish::Vulkan
             auto& executeData = graph->GetExecutionData();
             u32 frameIndex = graph->GetExecutionFrameIndex();
 
+            // Culled nodes are never submitted, so drop anything that was encoded into them anyway
+            for (u32 nodeIndex = 0; nodeIndex < graph->GetNodeCount(); nodeIndex++)
+            {
+                auto& node = graph->GetNode(nodeIndex);
+                if (!node.Culled)
+                    continue;
+
+                CommandBuffer* buffer = static_cast<CommandBuffer*>(node.Buffer);
+                if (!frameScope)
+                {
+                    // Frame command buffers have their pools reset at once, so only these need to be freed
+                    for (auto& submission : buffer->GetEncoderSubmissions())
+                        Context::Commands().FreeBuffers(submission.AllocInfo, submission.Buffers.data(), submission.Buffers.size());
+                }
+                buffer->ClearSubmissions();
+            }
+
             if (executeData.SubmissionOrder.empty())
                 continue;
 
             // Process the submission differently depending on what kind of synchronization we support
             if (Context::Devices().SupportsTimelines())
+            {
                 ProcessSingleSubmissionWithTimelines(graph, frameScope, finalFences, finalSemaphores, finalSemaphoreValues);
+
+                // Graphs that wait on the whole frame are still tracked so that others can wait on them
+                if (frameScope && UsesFrameResources())
+                    UpdateFrameResources(graph);
+            }
             else
                 ProcessSingleSubmissionSequential(graph, frameScope, finalFences, finalSemaphores);
 
             // Insert the completion synchronization objects for this graph so that we maintain an entire list
-            // of objects that need to be waited on to ensure command completion
+            // of objects that need to be waited on to ensure command completion. Batched submissions signal
+            // one fence per queue instead, which is added once the batches are flushed
             auto& fences = executeData.CompletionFences[frameIndex];
             auto& sems = executeData.CompletionSemaphores[frameIndex];
             auto& vals = executeData.WaitSemaphoreValues;
-            finalFences->insert(finalFences->end(), fences.begin(), fences.end());
+            if (!batchSubmits)
+                finalFences->insert(finalFences->end(), fences.begin(), fences.end());
             finalSemaphores->insert(finalSemaphores->end(), sems.begin(), sems.end());
             finalSemaphoreValues->insert(finalSemaphoreValues->end(), vals.begin(), vals.end());
         }
+
+        if (batchSubmits)
+            FlushQueueBatches(finalFences);
+    }
+
+    bool SubmissionHandler::ShouldBatchSubmits(bool frameScope)
+    {
+        // Frame submissions are collected per queue and submitted together. Timeline semaphores may be waited
+        // on before their signal is submitted, so the queues can be flushed in any order. With a single frame
+        // buffer the previous frame's wait semaphores are appended to while batches still point into them
+        return frameScope &&
+            Context::Devices().SupportsTimelines() &&
+            Flourish::Context::FrameBufferCount() > 1;
+    }
+
+    void SubmissionHandler::QueueBatchedSubmit(
+        GPUWorkloadType workload,
+        const VkSubmitInfo& submitInfo,
+        const VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo,
+        VkCommandBuffer buffer,
+        VkFence completionFence)
+    {
+        // Workloads that share a queue share a batch so that their relative order is kept
+        VkQueue queue = Context::Queues().Queue(workload);
+        QueueBatch* batch = nullptr;
+        for (auto& existing : m_QueueBatches)
+        {
+            if (existing.Queue == queue)
+            {
+                batch = &existing;
+                break;
+            }
+            if (!batch && !existing.Queue)
+                batch = &existing;
+        }
+        if (!batch)
+            batch = &m_QueueBatches.emplace_back();
+
+        batch->Queue = queue;
+        batch->Workload = workload;
+        batch->SubmitInfos.emplace_back(submitInfo);
+        batch->TimelineSubmitInfos.emplace_back(timelineSubmitInfo);
+        batch->CommandBuffers.emplace_back(buffer);
+
+        // Any completion fence can signal the batch since a fence covers the entire call
+        if (completionFence)
+            batch->Fence = completionFence;
+    }
+
+    void SubmissionHandler::FlushQueueBatches(std::vector<VkFence>* finalFences)
+    {
+        FL_PROFILE_FUNCTION();
+
+        for (auto& batch : m_QueueBatches)
+        {
+            if (batch.SubmitInfos.empty())
+            {
+                batch.Queue = VK_NULL_HANDLE;
+                continue;
+            }
+
+            // Pointers are resolved here since the arrays may have grown while the batch was collected
+            u32 semaphoresWaited = 0;
+            for (u32 i = 0; i < batch.SubmitInfos.size(); i++)
+            {
+                batch.SubmitInfos[i].pNext = &batch.TimelineSubmitInfos[i];
+                batch.SubmitInfos[i].pCommandBuffers = &batch.CommandBuffers[i];
+                semaphoresWaited += batch.SubmitInfos[i].waitSemaphoreCount;
+            }
+
+            // Batches without a completion submission are always waited on by one that has it, so
+            // only fenced batches need to be tracked
+            if (batch.Fence)
+            {
+                Synchronization::ResetFences(&batch.Fence, 1);
+                finalFences->emplace_back(batch.Fence);
+            }
+
+            Context::Queues().LockQueue(batch.Workload, true);
+            FL_VK_ENSURE_RESULT(Synchronization::QueueSubmit(
+                batch.Queue,
+                batch.SubmitInfos.data(),
+                static_cast<u32>(batch.SubmitInfos.size()),
+                batch.Fence
+            ), "Submission handler batched submit");
+            Context::Queues().LockQueue(batch.Workload, false);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::QueueSubmits);
+            Flourish::Context::IncrementFrameCounter(FrameCounter::SemaphoresWaited, semaphoresWaited);
+
+            batch.Queue = VK_NULL_HANDLE;
+            batch.Fence = VK_NULL_HANDLE;
+            batch.SubmitInfos.clear();
+            batch.TimelineSubmitInfos.clear();
+            batch.CommandBuffers.clear();
+        }
     }
 
     void SubmissionHandler::ProcessSingleSubmissionSequential(
@@ -377,7 +657,7 @@ namespace Flourish::Vulkan
         ProcessGraph(
             graph,
             frameScope,
-            [finalSemaphores, waitFlags](VkSubmitInfo& submitInfo, VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo) {
+            [finalSemaphores, waitFlags](int submitIndex, VkSubmitInfo& submitInfo, VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo) {
                 if (submitInfo.waitSemaphoreCount > 0) return;
 
                 // If this is the first submission of this graph, we want to wait on last frame or graph to finish. We do this
@@ -419,9 +699,19 @@ namespace Flourish::Vulkan
         ProcessGraph(
             graph,
             frameScope,
-            [frameScope, waitFlags, frameSems, frameVals]
-            (VkSubmitInfo& submitInfo, VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo) {
-                if (!frameScope || submitInfo.waitSemaphoreCount > 0) return;
+            [this, graph, frameScope, waitFlags, frameSems, frameVals]
+            (int submitIndex, VkSubmitInfo& submitInfo, VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo) {
+                if (!frameScope) return;
+
+                // Graphs that track their resources across frames only wait on the submissions that last accessed
+                // them rather than on the whole previous frame
+                if (!graph->GetExecutionData().ConservativeFrameSync)
+                {
+                    AddFrameResourceWaits(graph, submitIndex, submitInfo, timelineSubmitInfo);
+                    return;
+                }
+
+                if (submitInfo.waitSemaphoreCount > 0) return;
 
                 // If this submission is a root node of the graph (no waiting submissions),
                 // we want to wait on the last frame to finish
@@ -472,18 +762,23 @@ namespace Flourish::Vulkan
             submission.Buffers.size()
         );
 
-        // Transition layout for presentation
-        Texture::TransitionImageLayout(
-            context->Swapchain().GetImage(),
-            VK_IMAGE_LAYOUT_GENERAL,
-            VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-            VK_IMAGE_ASPECT_COLOR_BIT,
-            0, 1,
-            0, 1,
-            VK_ACCESS_MEMORY_WRITE_BIT, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-            0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-            finalBuf
-        );
+        // Transition layout for presentation. Offscreen images stay in the general layout
+        // so that they can be read back
+        bool offscreen = context->IsOffscreen();
+        if (!offscreen)
+        {
+            Texture::TransitionImageLayout(
+                context->Swapchain().GetImage(),
+                VK_IMAGE_LAYOUT_GENERAL,
+                VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                VK_IMAGE_ASPECT_COLOR_BIT,
+                0, 1,
+                0, 1,
+                VK_ACCESS_MEMORY_WRITE_BIT, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
+                0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                finalBuf
+            );
+        }
 
         vkEndCommandBuffer(finalBuf);
 
@@ -495,8 +790,11 @@ namespace Flourish::Vulkan
         }
 
         // Temporarily add this since we must wait on it before drawing to the swapchain images
-        frameSems.push_back(context->GetImageAvailableSemaphore());
-        frameVals.push_back(0);
+        if (!offscreen)
+        {
+            frameSems.push_back(context->GetImageAvailableSemaphore());
+            frameVals.push_back(0);
+        }
 
         while (m_RenderContextWaitFlags.size() < frameSems.size())
             m_RenderContextWaitFlags.emplace_back(VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT);
@@ -504,7 +802,7 @@ namespace Flourish::Vulkan
         std::array<u64, 2> signalSemaphoreValues = { context->GetSignalValue(), 0 };
         VkTimelineSemaphoreSubmitInfo timelineSubmitInfo{};
         timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
-        timelineSubmitInfo.signalSemaphoreValueCount = signalSemaphoreValues.size();
+        timelineSubmitInfo.signalSemaphoreValueCount = offscreen ? 1 : signalSemaphoreValues.size();
         timelineSubmitInfo.pSignalSemaphoreValues = signalSemaphoreValues.data();
         timelineSubmitInfo.waitSemaphoreValueCount = frameVals.size();
         timelineSubmitInfo.pWaitSemaphoreValues = frameVals.data();
@@ -517,7 +815,8 @@ namespace Flourish::Vulkan
         finalSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         finalSubmitInfo.commandBufferCount = 1;
         finalSubmitInfo.pCommandBuffers = &finalBuf;
-        finalSubmitInfo.signalSemaphoreCount = signalSemaphores.size();
+        // Nothing will wait on the swapchain semaphore if we are not presenting
+        finalSubmitInfo.signalSemaphoreCount = offscreen ? 1 : signalSemaphores.size();
         finalSubmitInfo.pSignalSemaphores = signalSemaphores.data();
         finalSubmitInfo.waitSemaphoreCount = frameSems.size();
         finalSubmitInfo.pWaitSemaphores = frameSems.data();
@@ -529,12 +828,225 @@ namespace Flourish::Vulkan
         Synchronization::ResetFences(&fence, 1);
 
         Context::Queues().LockQueue(GPUWorkloadType::Graphics, true);
-        FL_VK_ENSURE_RESULT(vkQueueSubmit(
+        FL_VK_ENSURE_RESULT(Synchronization::QueueSubmit(
             Context::Queues().Queue(GPUWorkloadType::Graphics),
-            1, &finalSubmitInfo, fence
+            finalSubmitInfo, fence
         ), "Present context graphics submit");
         Context::Queues().LockQueue(GPUWorkloadType::Graphics, false);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::QueueSubmits);
+        Flourish::Context::IncrementFrameCounter(FrameCounter::SemaphoresWaited, finalSubmitInfo.waitSemaphoreCount);
+
+        if (!offscreen)
+            Present(context);
+
+        if (UsesFrameResources())
+            UpdateContextFrameResources(context);
+
+        // Clear the previous sync objects since we already waited on them
+        frameFences.clear();
+        frameSems.clear();
+        frameVals.clear();
+
+        // Insert the new frontmost frame dependency, which is the final graphics submission
+        frameFences.emplace_back(fence);
+        frameSems.emplace_back(context->GetRenderFinishedSignalSemaphore());
+        frameVals.emplace_back(context->GetSignalValue());
+    }
+
+    void SubmissionHandler::SubmissionThreadLoop()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_SubmissionThreadLock);
+                m_SubmissionThreadCondition.wait(lock, [this]() { return m_SubmissionThreadStopping || m_FrameSubmissionPending; });
+                if (!m_FrameSubmissionPending)
+                    break;
+            }
+
+            // The frame counters only advance once the frame has been waited on, so processing sees the same
+            // frame as the thread that ended it
+            try
+            {
+                ProcessFrameSubmissions();
+            }
+            catch (...)
+            {
+                m_SubmissionThreadError = std::current_exception();
+            }
+
+            {
+                std::lock_guard lock(m_SubmissionThreadLock);
+                m_FrameSubmissionPending = false;
+            }
+            m_SubmissionThreadCondition.notify_all();
+        }
+    }
+
+    bool SubmissionHandler::UsesFrameResources() const
+    {
+        return Flourish::Context::FineGrainedFrameDependencies() && Context::Devices().SupportsTimelines();
+    }
+
+    void SubmissionHandler::AddFrameResourceWaits(
+        RenderGraph* graph,
+        int submitIndex,
+        VkSubmitInfo& submitInfo,
+        VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo)
+    {
+        auto& executeData = graph->GetExecutionData();
+        auto& submitData = executeData.SubmitData[submitIndex];
+        if (submitData.FrameResourceCount == 0)
+            return;
+
+        if (m_FrameResourceWaitCount == m_FrameResourceWaits.size())
+            m_FrameResourceWaits.emplace_back();
+        auto& waits = m_FrameResourceWaits[m_FrameResourceWaitCount];
+
+        // Start from the waits within the graph
+        u32 graphWaitCount = submitInfo.waitSemaphoreCount;
+        waits.Semaphores.assign(submitInfo.pWaitSemaphores, submitInfo.pWaitSemaphores + graphWaitCount);
+        waits.Values.assign(timelineSubmitInfo.pWaitSemaphoreValues, timelineSubmitInfo.pWaitSemaphoreValues + graphWaitCount);
+        waits.StageFlags.assign(submitInfo.pWaitDstStageMask, submitInfo.pWaitDstStageMask + graphWaitCount);
+
+        const auto addWait = [&waits](const FrameSyncPoint& point)
+        {
+            if (!point.Semaphore || IsFrameSyncComplete(point))
+                return;
+
+            // Timeline values only increase, so waiting on the largest one covers the rest
+            for (u32 i = 0; i < waits.Semaphores.size(); i++)
+            {
+                if (waits.Semaphores[i] == point.Semaphore)
+                {
+                    waits.Values[i] = std::max(waits.Values[i], point.Value);
+                    return;
+                }
+            }
+
+            waits.Semaphores.emplace_back(point.Semaphore);
+            waits.Values.emplace_back(point.Value);
+            waits.StageFlags.emplace_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        };
+
+        // Reads only need to wait on the last write, while writes also need to wait on every read since
+        for (u32 i = submitData.FrameResourceOffset; i < submitData.FrameResourceOffset + submitData.FrameResourceCount; i++)
+        {
+            auto& frameResource = executeData.FrameResources[i];
+            auto found = m_FrameResources.find(frameResource.ResourceId);
+            if (found == m_FrameResources.end())
+                continue;
+
+            addWait(found->second.LastWrite);
+            if (frameResource.Access & RenderGraphResourceAccessFlags::Write)
+                for (auto& read : found->second.Reads)
+                    addWait(read);
+        }
 
+        if (waits.Semaphores.size() == graphWaitCount)
+            return;
+        m_FrameResourceWaitCount++;
+
+        submitInfo.waitSemaphoreCount = waits.Semaphores.size();
+        submitInfo.pWaitSemaphores = waits.Semaphores.data();
+        submitInfo.pWaitDstStageMask = waits.StageFlags.data();
+        timelineSubmitInfo.waitSemaphoreValueCount = waits.Values.size();
+        timelineSubmitInfo.pWaitSemaphoreValues = waits.Values.data();
+    }
+
+    void SubmissionHandler::UpdateFrameResources(RenderGraph* graph)
+    {
+        auto& executeData = graph->GetExecutionData();
+        u32 frameIndex = graph->GetExecutionFrameIndex();
+        const auto syncPoint = [&executeData, frameIndex](int submitIndex)
+        {
+            auto& submitData = executeData.SubmitData[submitIndex];
+            return FrameSyncPoint{
+                submitData.SignalSemaphores[frameIndex],
+                submitData.SignalSemaphoreValue,
+                Flourish::Context::FrameCount()
+            };
+        };
+
+        for (auto& frameResource : executeData.FrameResources)
+        {
+            auto& state = m_FrameResources[frameResource.ResourceId];
+            if (frameResource.LastWriteSubmitIndex != -1)
+            {
+                state.LastWrite = syncPoint(frameResource.LastWriteSubmitIndex);
+                state.Reads.clear();
+            }
+
+            for (u32 i = frameResource.ReadOffset; i < frameResource.ReadOffset + frameResource.ReadCount; i++)
+                AddFrameResourceRead(state, syncPoint(executeData.FrameResourceReads[i]));
+        }
+    }
+
+    void SubmissionHandler::UpdateContextFrameResources(RenderContext* context)
+    {
+        FrameSyncPoint point = {
+            context->GetRenderFinishedSignalSemaphore(),
+            context->GetSignalValue(),
+            Flourish::Context::FrameCount()
+        };
+        for (u64 resourceId : context->GetFrameReads())
+            AddFrameResourceRead(m_FrameResources[resourceId], point);
+    }
+
+    void SubmissionHandler::PruneFrameResources()
+    {
+        FL_PROFILE_FUNCTION();
+
+        // Drop resources that have not been accessed for a while, which also covers destroyed ones
+        for (auto it = m_FrameResources.begin(); it != m_FrameResources.end();)
+        {
+            auto& state = it->second;
+            if (state.LastWrite.Semaphore && IsFrameSyncComplete(state.LastWrite))
+                state.LastWrite = FrameSyncPoint();
+            state.Reads.erase(
+                std::remove_if(state.Reads.begin(), state.Reads.end(), IsFrameSyncComplete),
+                state.Reads.end()
+            );
+
+            if (!state.LastWrite.Semaphore && state.Reads.empty())
+                it = m_FrameResources.erase(it);
+            else
+                ++it;
+        }
+
+        // Keep resources that are still in flight from triggering this every frame
+        m_FrameResourcePruneSize = std::max(256u, static_cast<u32>(m_FrameResources.size()) * 2);
+    }
+
+    bool SubmissionHandler::IsFrameSyncComplete(const FrameSyncPoint& point)
+    {
+        // BeginFrame waits on everything submitted FrameBufferCount frames ago
+        return point.Frame + Flourish::Context::FrameBufferCount() <= Flourish::Context::FrameCount();
+    }
+
+    void SubmissionHandler::AddFrameResourceRead(FrameResourceState& state, const FrameSyncPoint& point)
+    {
+        // Resources that are only ever read would otherwise accumulate a read per frame
+        state.Reads.erase(
+            std::remove_if(state.Reads.begin(), state.Reads.end(), IsFrameSyncComplete),
+            state.Reads.end()
+        );
+
+        for (auto& read : state.Reads)
+        {
+            if (read.Semaphore == point.Semaphore)
+            {
+                read.Value = std::max(read.Value, point.Value);
+                read.Frame = std::max(read.Frame, point.Frame);
+                return;
+            }
+        }
+
+        state.Reads.emplace_back(point);
+    }
+
+    void SubmissionHandler::Present(RenderContext* context)
+    {
         VkSwapchainKHR swapchain[1] = { context->Swapchain().GetSwapchain() };
         u32 imageIndex[1] = { context->Swapchain().GetActiveImageIndex() };
 
@@ -560,16 +1072,102 @@ namespace Flourish::Vulkan
             FL_LOG_CRITICAL("Failed to present with error %d", result);
             throw std::exception();
         }
+    }
 
-        // Clear the previous sync objects since we already waited on them
-        frameFences.clear();
-        frameSems.clear();
-        frameVals.clear();
+    void SubmissionHandler::RecordGraphBarrier(
+        VkCommandBuffer primary,
+        const GraphExecuteData& executeData,
+        const SubmissionBarrier& barrier)
+    {
+        VkMemoryBarrier2KHR memoryBarrier;
+        VkDependencyInfoKHR dependencyInfo;
+        ResolveGraphBarrier(executeData, barrier, memoryBarrier, dependencyInfo);
+        Synchronization::PipelineBarrier(primary, dependencyInfo);
+    }
 
-        // Insert the new frontmost frame dependency, which is the final graphics submission
-        frameFences.emplace_back(fence);
-        frameSems.emplace_back(context->GetRenderFinishedSignalSemaphore());
-        frameVals.emplace_back(context->GetSignalValue());
+    void SubmissionHandler::ResolveGraphBarrier(
+        const GraphExecuteData& executeData,
+        const SubmissionBarrier& barrier,
+        VkMemoryBarrier2KHR& memoryBarrier,
+        VkDependencyInfoKHR& dependencyInfo)
+    {
+        // Reused across calls so that recording barriers does not allocate every frame
+        thread_local static std::vector<VkBufferMemoryBarrier2KHR> bufferBarriers;
+        thread_local static std::vector<VkImageMemoryBarrier2KHR> imageBarriers;
+        bufferBarriers.clear();
+        imageBarriers.clear();
+
+        memoryBarrier = barrier.MemoryBarrier;
+        for (u32 i = 0; i < barrier.ResourceBarrierCount; i++)
+        {
+            auto& resourceBarrier = executeData.ResourceBarriers[barrier.ResourceBarrierOffset + i];
+
+            // Handles are resolved here rather than at build time since dynamic buffers change every frame
+            if (resourceBarrier.ResourceType == RenderGraphResourceType::Buffer)
+            {
+                auto buffer = static_cast<const Buffer*>(static_cast<const Flourish::Buffer*>(resourceBarrier.Resource));
+
+                auto& bufferBarrier = bufferBarriers.emplace_back();
+                bufferBarrier = {};
+                bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+                bufferBarrier.srcStageMask = resourceBarrier.SrcStages;
+                bufferBarrier.srcAccessMask = resourceBarrier.SrcAccess;
+                bufferBarrier.dstStageMask = resourceBarrier.DstStages;
+                bufferBarrier.dstAccessMask = resourceBarrier.DstAccess;
+                bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarrier.buffer = buffer->GetGPUBuffer();
+                bufferBarrier.offset = 0;
+                bufferBarrier.size = VK_WHOLE_SIZE;
+                continue;
+            }
+
+            auto texture = static_cast<const Texture*>(static_cast<const Flourish::Texture*>(resourceBarrier.Resource));
+            VkImage image = texture->GetImage();
+            if (!image)
+            {
+                // Textures that wrap an external image view (i.e. swapchain images) do not own
+                // their image, so fall back to a memory barrier
+                memoryBarrier.srcStageMask |= resourceBarrier.SrcStages;
+                memoryBarrier.srcAccessMask |= resourceBarrier.SrcAccess;
+                memoryBarrier.dstStageMask |= resourceBarrier.DstStages;
+                memoryBarrier.dstAccessMask |= resourceBarrier.DstAccess;
+                continue;
+            }
+
+            // Textures always rest in the same layout between encoders, so the barrier only transitions
+            // when discarding the previous contents
+            VkImageLayout layout = texture->GetRestingLayout();
+            auto& imageBarrier = imageBarriers.emplace_back();
+            imageBarrier = {};
+            imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+            imageBarrier.srcStageMask = resourceBarrier.SrcStages;
+            imageBarrier.srcAccessMask = resourceBarrier.SrcAccess;
+            imageBarrier.dstStageMask = resourceBarrier.DstStages;
+            imageBarrier.dstAccessMask = resourceBarrier.DstAccess;
+            imageBarrier.oldLayout = resourceBarrier.Discard ? VK_IMAGE_LAYOUT_UNDEFINED : layout;
+            imageBarrier.newLayout = layout;
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.image = image;
+            imageBarrier.subresourceRange.aspectMask = texture->IsDepthImage() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+            imageBarrier.subresourceRange.baseMipLevel = 0;
+            imageBarrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+            imageBarrier.subresourceRange.baseArrayLayer = 0;
+            imageBarrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        }
+
+        // The memory barrier only carries generic resources and execution dependencies, so skip it when empty
+        bool hasMemoryBarrier = memoryBarrier.srcStageMask || memoryBarrier.dstStageMask;
+
+        dependencyInfo = {};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.memoryBarrierCount = hasMemoryBarrier ? 1 : 0;
+        dependencyInfo.pMemoryBarriers = &memoryBarrier;
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<u32>(bufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers = bufferBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount = static_cast<u32>(imageBarriers.size());
+        dependencyInfo.pImageMemoryBarriers = imageBarriers.data();
     }
 
     void SubmissionHandler::ExecuteRenderPassCommands(
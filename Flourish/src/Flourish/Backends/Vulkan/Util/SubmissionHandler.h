@@ -4,6 +4,8 @@
 #include "Flourish/Backends/Vulkan/Util/Common.h"
 #include "Flourish/Backends/Vulkan/Util/Synchronization.h"
 
+#include <condition_variable>
+
 namespace Flourish::Vulkan
 {
     class Framebuffer;
@@ -11,11 +13,23 @@ namespace Flourish::Vulkan
     class SubmissionHandler
     {
     public:
-        void Initialize();
+        void Initialize(const ContextInitializeInfo& initInfo);
         void Shutdown();
 
         void WaitOnFrameSemaphores();
         void ProcessFrameSubmissions();
+
+        // Hands the frame's submissions to the submission thread when there is one, otherwise processes them here
+        void QueueFrameSubmissions();
+
+        // Blocks until the submission thread is done with the frame it was last handed. Errors raised while
+        // processing the frame are rethrown here
+        void WaitOnFrameSubmissions();
+
+        // TS
+        // Blocks until the submission thread is done with the frame it was last handed, leaving any error for
+        // WaitOnFrameSubmissions. Does nothing without a submission thread or when called from it
+        void WaitOnSubmissionThread();
         
         // TS
         void ProcessPushSubmission(Flourish::RenderGraph* graph, std::function<void()> callback = nullptr);
@@ -23,10 +37,11 @@ namespace Flourish::Vulkan
         
     private:
         void PresentContext(RenderContext* context);
+        void Present(RenderContext* context);
         void ProcessGraph(
             RenderGraph* graph,
             bool frameScope,
-            std::function<void(VkSubmitInfo&, VkTimelineSemaphoreSubmitInfo&)>&& preSubmitCallback
+            std::function<void(int, VkSubmitInfo&, VkTimelineSemaphoreSubmitInfo&)>&& preSubmitCallback
         );
         void ProcessSubmission(
             Flourish::RenderGraph* const* graphs,
@@ -50,7 +65,112 @@ namespace Flourish::Vulkan
             std::vector<u64>* finalSemaphoreValues = nullptr
         );
 
+        bool ShouldBatchSubmits(bool frameScope);
+        void QueueBatchedSubmit(
+            GPUWorkloadType workload,
+            const VkSubmitInfo& submitInfo,
+            const VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo,
+            VkCommandBuffer buffer,
+            VkFence completionFence
+        );
+        void FlushQueueBatches(std::vector<VkFence>* finalFences);
+
+        bool UsesFrameResources() const;
+        void AddFrameResourceWaits(
+            RenderGraph* graph,
+            int submitIndex,
+            VkSubmitInfo& submitInfo,
+            VkTimelineSemaphoreSubmitInfo& timelineSubmitInfo
+        );
+        void UpdateFrameResources(RenderGraph* graph);
+        void UpdateContextFrameResources(RenderContext* context);
+        void PruneFrameResources();
+        void SubmissionThreadLoop();
+
+    private:
+        // An encoder of the graph along with where it is recorded
+        struct RecordEncoder
+        {
+            u32 OrderIndex;
+            u32 SubIndex;
+            u32 SyncIndex; // Into GraphExecuteData::SubmissionSyncs
+            bool ResetQueryPool;
+            d64 RecordTime = 0.0; // CPU nanoseconds
+        };
+
+        // A primary buffer recording a contiguous range of encoders, which becomes one submission
+        struct RecordTask
+        {
+            int SubmitIndex;
+            GPUWorkloadType Workload;
+            u32 EncoderOffset;
+            u32 EncoderCount = 0;
+            VkCommandBuffer Buffer = VK_NULL_HANDLE;
+            CommandBufferAllocInfo AllocInfo;
+        };
+
+        // Frame submissions bound for the same queue, submitted in one call once every frame graph is processed
+        struct QueueBatch
+        {
+            VkQueue Queue = VK_NULL_HANDLE;
+            GPUWorkloadType Workload;
+
+            // Signals once every submission in the batch completes, null if no completion submission is included
+            VkFence Fence = VK_NULL_HANDLE;
+
+            std::vector<VkSubmitInfo> SubmitInfos;
+            std::vector<VkTimelineSemaphoreSubmitInfo> TimelineSubmitInfos;
+            std::vector<VkCommandBuffer> CommandBuffers;
+        };
+
+        // A submission that accessed a frame resource. Anything submitted FrameBufferCount frames ago has
+        // already been waited on by the CPU, so the semaphore is never touched again after that
+        struct FrameSyncPoint
+        {
+            VkSemaphore Semaphore = VK_NULL_HANDLE;
+            u64 Value = 0;
+            u64 Frame = 0;
+        };
+
+        struct FrameResourceState
+        {
+            FrameSyncPoint LastWrite;
+            std::vector<FrameSyncPoint> Reads; // Since the last write
+        };
+
+        // Wait list of a submission that waits on frame resources. Entries are reused each frame and only ever
+        // moved as a whole, which keeps the storage that pending submissions point into in place
+        struct FrameResourceWaits
+        {
+            std::vector<VkSemaphore> Semaphores;
+            std::vector<u64> Values;
+            std::vector<VkPipelineStageFlags> StageFlags;
+        };
+
     private:
+        static void RecordSubmission(
+            RenderGraph* graph,
+            bool frameScope,
+            bool timeRecording,
+            RecordTask& task,
+            RecordEncoder* encoders
+        );
+        static bool IsFrameSyncComplete(const FrameSyncPoint& point);
+        static void AddFrameResourceRead(FrameResourceState& state, const FrameSyncPoint& point);
+        static void RecordGraphBarrier(
+            VkCommandBuffer primary,
+            const GraphExecuteData& executeData,
+            const SubmissionBarrier& barrier
+        );
+
+        // Resolves resource handles into the dependency, which points into thread local storage that is
+        // reused by the next call
+        static void ResolveGraphBarrier(
+            const GraphExecuteData& executeData,
+            const SubmissionBarrier& barrier,
+            VkMemoryBarrier2KHR& memoryBarrier,
+            VkDependencyInfoKHR& dependencyInfo
+        );
         static void ExecuteRenderPassCommands(
             VkCommandBuffer primary,
             Framebuffer* framebuffer,
@@ -64,5 +184,20 @@ namespace Flourish::Vulkan
         std::array<std::vector<VkFence>, Flourish::Context::MaxFrameBufferCount> m_FrameWaitFences;
         std::vector<VkPipelineStageFlags> m_FrameWaitFlags;
         std::vector<VkPipelineStageFlags> m_RenderContextWaitFlags;
+        std::vector<QueueBatch> m_QueueBatches;
+        std::unordered_map<u64, FrameResourceState> m_FrameResources; // Keyed by resource id
+        std::vector<FrameResourceWaits> m_FrameResourceWaits;
+        u32 m_FrameResourceWaitCount = 0;
+        u32 m_FrameResourcePruneSize = 256;
+
+        std::thread m_SubmissionThread;
+        std::mutex m_SubmissionThreadLock;
+        std::condition_variable m_SubmissionThreadCondition;
+        bool m_FrameSubmissionPending = false;
+        bool m_SubmissionThreadStopping = false;
+        std::exception_ptr m_SubmissionThreadError;
+
+        // Graphs with fewer encoders are not worth waking the workers for
+        static constexpr u32 MinParallelRecordEncoders = 16;
     };
 }
@@ -32,7 +32,10 @@ namespace Flourish::Vulkan
         m_CurrentHeight = createInfo.Height;
         m_ClearColor = createInfo.ClearColor;
 
-        PopulateSwapchainInfo();
+        if (IsOffscreen())
+            m_Info.SurfaceFormat = { VK_FORMAT_R8G8B8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+        else
+            PopulateSwapchainInfo();
         RecreateSwapchain();
         
         for (u32 frame = 0; frame < m_ImageAvailableSemaphores.size(); frame++)
@@ -73,6 +76,14 @@ namespace Flourish::Vulkan
 
         m_SyncIndex = Flourish::Context::FrameIndex();
 
+        // Offscreen images are used in lockstep with the frame index, so they are
+        // guaranteed to be free once the frame has begun
+        if (IsOffscreen())
+        {
+            m_ActiveImageIndex = m_SyncIndex;
+            return;
+        }
+
         VkSemaphore currentSemaphore = GetImageAvailableSemaphore();
         VkFence currentFence = GetImageAvailableFence();
         Synchronization::WaitForFences(&currentFence, 1);
@@ -211,6 +222,12 @@ namespace Flourish::Vulkan
 
         m_Valid = false;
 
+        if (IsOffscreen())
+        {
+            RecreateOffscreenImages();
+            return;
+        }
+
         auto device = Context::Devices().Device();
         auto physicalDevice = Context::Devices().PhysicalDevice();
 
@@ -313,26 +330,14 @@ namespace Flourish::Vulkan
         chainImages.resize(imageCount);
         vkGetSwapchainImagesKHR(device, m_Swapchain, &imageCount, chainImages.data());
 
-        // Create renderpass compatible with all images
-        // Does not need to be recreated
-        RenderPassCreateInfo rpCreateInfo;
-        rpCreateInfo.ColorAttachments = {{
-            Common::RevertColorFormat(m_Info.SurfaceFormat.format),
-            AttachmentInitialization::Clear,
-            true
-        }};
-        rpCreateInfo.Subpasses = {{
-            {}, {{ SubpassAttachmentType::Color, 0 }}
-        }};
-        if (!m_RenderPass)
-            m_RenderPass = std::make_shared<RenderPass>(rpCreateInfo);
+        CreateRenderPass();
 
         // Populate image data
         m_ImageData.clear();
         TextureCreateInfo texCreateInfo;
         texCreateInfo.Width = m_CurrentWidth;
         texCreateInfo.Height = m_CurrentHeight;
-        texCreateInfo.Format = rpCreateInfo.ColorAttachments[0].Format;
+        texCreateInfo.Format = Common::RevertColorFormat(m_Info.SurfaceFormat.format);
         texCreateInfo.Usage = TextureUsageFlags::All;
         FramebufferCreateInfo fbCreateInfo;
         fbCreateInfo.RenderPass = m_RenderPass;
@@ -365,6 +370,68 @@ namespace Flourish::Vulkan
         m_Valid = true;
     }
 
+    void Swapchain::RecreateOffscreenImages()
+    {
+        if (m_CurrentWidth == 0 || m_CurrentHeight == 0)
+            return;
+
+        if (!m_ImageData.empty())
+            CleanupSwapchain();
+
+        CreateRenderPass();
+
+        // One image per frame in flight. Unlike swapchain images, these are allocated and owned
+        // by their textures, so there is no separate view to manage
+        TextureCreateInfo texCreateInfo;
+        texCreateInfo.Width = m_CurrentWidth;
+        texCreateInfo.Height = m_CurrentHeight;
+        texCreateInfo.Format = Common::RevertColorFormat(m_Info.SurfaceFormat.format);
+        texCreateInfo.Usage = TextureUsageFlags::All;
+        texCreateInfo.MipCount = 1;
+        FramebufferCreateInfo fbCreateInfo;
+        fbCreateInfo.RenderPass = m_RenderPass;
+        fbCreateInfo.Width = m_CurrentWidth;
+        fbCreateInfo.Height = m_CurrentHeight;
+        fbCreateInfo.ColorAttachments = {
+            { m_ClearColor }
+        };
+        for (u32 i = 0; i < Flourish::Context::FrameBufferCount(); i++)
+        {
+            ImageData imageData{};
+            imageData.Texture = std::make_shared<Texture>(texCreateInfo);
+            imageData.Image = imageData.Texture->GetImage();
+            imageData.ImageView = VK_NULL_HANDLE;
+
+            fbCreateInfo.ColorAttachments[0].Texture = imageData.Texture;
+            imageData.Framebuffer = std::make_shared<Framebuffer>(fbCreateInfo);
+
+            m_ImageData.push_back(imageData);
+        }
+
+        FL_LOG_TRACE("Created %d offscreen images", m_ImageData.size());
+
+        m_Valid = true;
+    }
+
+    void Swapchain::CreateRenderPass()
+    {
+        // Create renderpass compatible with all images
+        // Does not need to be recreated
+        if (m_RenderPass)
+            return;
+
+        RenderPassCreateInfo rpCreateInfo;
+        rpCreateInfo.ColorAttachments = {{
+            Common::RevertColorFormat(m_Info.SurfaceFormat.format),
+            AttachmentInitialization::Clear,
+            true
+        }};
+        rpCreateInfo.Subpasses = {{
+            {}, {{ SubpassAttachmentType::Color, 0 }}
+        }};
+        m_RenderPass = std::make_shared<RenderPass>(rpCreateInfo);
+    }
+
     void Swapchain::CleanupSwapchain()
     {
         // We need to go through and reset the pointers here because we copy
@@ -384,9 +451,11 @@ namespace Flourish::Vulkan
         {
             auto device = Context::Devices().Device();
             for (auto& data : imageData)
-                vkDestroyImageView(device, data.ImageView, nullptr);
+                if (data.ImageView)
+                    vkDestroyImageView(device, data.ImageView, nullptr);
             
-            vkDestroySwapchainKHR(device, swapchain, nullptr);
+            if (swapchain)
+                vkDestroySwapchainKHR(device, swapchain, nullptr);
         }, "Swapchain free");
 
         m_ImageData.clear();
@@ -31,12 +31,14 @@ namespace Flourish::Vulkan
         // TS
         inline VkSwapchainKHR GetSwapchain() const { return m_Swapchain; }
         inline VkImage GetImage() const { return m_ImageData[m_ActiveImageIndex].Image; }
+        inline Texture* GetTexture() const { return m_ImageData[m_ActiveImageIndex].Texture.get(); }
         inline Framebuffer* GetFramebuffer() const { return m_ImageData[m_ActiveImageIndex].Framebuffer.get(); }
         inline RenderPass* GetRenderPass() const { return m_RenderPass.get(); }
         inline u32 GetActiveImageIndex() const { return m_ActiveImageIndex; }
         inline void Recreate() { m_ShouldRecreate = true; }
         inline void RecreateImmediate() { RecreateSwapchain(); m_ShouldRecreate = false; }
         inline bool IsValid() const { return m_Valid; }
+        inline bool IsOffscreen() const { return !m_Surface; }
 
     private:
         struct ImageData
@@ -50,6 +52,8 @@ namespace Flourish::Vulkan
     private:
         void PopulateSwapchainInfo();
         void RecreateSwapchain();
+        void RecreateOffscreenImages();
+        void CreateRenderPass();
         void CleanupSwapchain();
 
     private:
@@ -6,6 +6,88 @@
 
 namespace Flourish::Vulkan
 {
+    // Legacy equivalent of a synchronization2 dependency. Stage masks of every barrier are combined
+    struct LegacyDependency
+    {
+        std::vector<VkMemoryBarrier> MemoryBarriers;
+        std::vector<VkBufferMemoryBarrier> BufferBarriers;
+        std::vector<VkImageMemoryBarrier> ImageBarriers;
+        VkPipelineStageFlags SrcStages;
+        VkPipelineStageFlags DstStages;
+    };
+
+    static LegacyDependency& ConvertDependency(const VkDependencyInfoKHR& dependencyInfo)
+    {
+        // Reused across calls so that the fallback does not allocate every barrier
+        thread_local static LegacyDependency dependency;
+        dependency.MemoryBarriers.clear();
+        dependency.BufferBarriers.clear();
+        dependency.ImageBarriers.clear();
+
+        VkPipelineStageFlags2KHR srcStages = 0;
+        VkPipelineStageFlags2KHR dstStages = 0;
+        for (u32 i = 0; i < dependencyInfo.memoryBarrierCount; i++)
+        {
+            auto& barrier = dependencyInfo.pMemoryBarriers[i];
+            srcStages |= barrier.srcStageMask;
+            dstStages |= barrier.dstStageMask;
+
+            // Barriers without accesses are pure execution dependencies which the stage masks cover
+            if (!barrier.srcAccessMask && !barrier.dstAccessMask)
+                continue;
+
+            auto& legacy = dependency.MemoryBarriers.emplace_back();
+            legacy.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            legacy.srcAccessMask = Synchronization::ConvertAccessFlags(barrier.srcAccessMask);
+            legacy.dstAccessMask = Synchronization::ConvertAccessFlags(barrier.dstAccessMask);
+        }
+
+        for (u32 i = 0; i < dependencyInfo.bufferMemoryBarrierCount; i++)
+        {
+            auto& barrier = dependencyInfo.pBufferMemoryBarriers[i];
+            srcStages |= barrier.srcStageMask;
+            dstStages |= barrier.dstStageMask;
+
+            auto& legacy = dependency.BufferBarriers.emplace_back();
+            legacy.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            legacy.srcAccessMask = Synchronization::ConvertAccessFlags(barrier.srcAccessMask);
+            legacy.dstAccessMask = Synchronization::ConvertAccessFlags(barrier.dstAccessMask);
+            legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+            legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+            legacy.buffer = barrier.buffer;
+            legacy.offset = barrier.offset;
+            legacy.size = barrier.size;
+        }
+
+        for (u32 i = 0; i < dependencyInfo.imageMemoryBarrierCount; i++)
+        {
+            auto& barrier = dependencyInfo.pImageMemoryBarriers[i];
+            srcStages |= barrier.srcStageMask;
+            dstStages |= barrier.dstStageMask;
+
+            auto& legacy = dependency.ImageBarriers.emplace_back();
+            legacy.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            legacy.srcAccessMask = Synchronization::ConvertAccessFlags(barrier.srcAccessMask);
+            legacy.dstAccessMask = Synchronization::ConvertAccessFlags(barrier.dstAccessMask);
+            legacy.oldLayout = barrier.oldLayout;
+            legacy.newLayout = barrier.newLayout;
+            legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+            legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+            legacy.image = barrier.image;
+            legacy.subresourceRange = barrier.subresourceRange;
+        }
+
+        // Legacy barriers cannot have empty stage masks
+        dependency.SrcStages = Synchronization::ConvertStageFlags(srcStages);
+        dependency.DstStages = Synchronization::ConvertStageFlags(dstStages);
+        if (!dependency.SrcStages)
+            dependency.SrcStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        if (!dependency.DstStages)
+            dependency.DstStages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+
+        return dependency;
+    }
+
     VkSemaphore Synchronization::CreateTimelineSemaphore(u32 initialValue)
     {
         VkSemaphoreTypeCreateInfo timelineCreateInfo{};
@@ -50,7 +132,10 @@ namespace Flourish::Vulkan
     {
         VkEventCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
-        createInfo.flags = VK_EVENT_CREATE_DEVICE_ONLY_BIT;
+
+        // The flag is part of synchronization2, but every event is only ever used from command buffers anyway
+        if (Context::Devices().SupportsSync2())
+            createInfo.flags = VK_EVENT_CREATE_DEVICE_ONLY_BIT_KHR;
 
         VkEvent event;
         vkCreateEvent(Context::Devices().Device(), &createInfo, NULL, &event);
@@ -64,6 +149,7 @@ namespace Flourish::Vulkan
             vkWaitForFences(Context::Devices().Device(), count, fences, true, UINT64_MAX),
             "WaitForFences"
         );
+        Flourish::Context::IncrementFrameCounter(FrameCounter::FencesWaited, count);
     }
 
     void Synchronization::ResetFences(const VkFence* fences, u32 count)
@@ -75,4 +161,248 @@ namespace Flourish::Vulkan
     {
         return vkGetFenceStatus(Context::Devices().Device(), fence) == VK_SUCCESS;
     }
+
+    u64 Synchronization::GetSemaphoreValue(VkSemaphore semaphore)
+    {
+        u64 value = 0;
+        vkGetSemaphoreCounterValueKHR(Context::Devices().Device(), semaphore, &value);
+        return value;
+    }
+
+    void Synchronization::WaitForSemaphore(VkSemaphore semaphore, u64 value)
+    {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &semaphore;
+        waitInfo.pValues = &value;
+        FL_VK_ENSURE_RESULT(
+            vkWaitSemaphoresKHR(Context::Devices().Device(), &waitInfo, UINT64_MAX),
+            "WaitForSemaphore"
+        );
+    }
+
+    void Synchronization::PipelineBarrier(VkCommandBuffer buffer, const VkDependencyInfoKHR& dependencyInfo)
+    {
+        if (Context::Devices().SupportsSync2())
+        {
+            vkCmdPipelineBarrier2KHR(buffer, &dependencyInfo);
+            return;
+        }
+
+        auto& legacy = ConvertDependency(dependencyInfo);
+        vkCmdPipelineBarrier(
+            buffer,
+            legacy.SrcStages,
+            legacy.DstStages,
+            dependencyInfo.dependencyFlags,
+            static_cast<u32>(legacy.MemoryBarriers.size()), legacy.MemoryBarriers.data(),
+            static_cast<u32>(legacy.BufferBarriers.size()), legacy.BufferBarriers.data(),
+            static_cast<u32>(legacy.ImageBarriers.size()), legacy.ImageBarriers.data()
+        );
+    }
+
+    void Synchronization::SetEvent(VkCommandBuffer buffer, VkEvent event, const VkDependencyInfoKHR& dependencyInfo)
+    {
+        if (Context::Devices().SupportsSync2())
+        {
+            vkCmdSetEvent2KHR(buffer, event, &dependencyInfo);
+            return;
+        }
+
+        vkCmdSetEvent(buffer, event, ConvertDependency(dependencyInfo).SrcStages);
+    }
+
+    void Synchronization::WaitEvent(VkCommandBuffer buffer, VkEvent event, const VkDependencyInfoKHR& dependencyInfo)
+    {
+        if (Context::Devices().SupportsSync2())
+        {
+            vkCmdWaitEvents2KHR(buffer, 1, &event, &dependencyInfo);
+            return;
+        }
+
+        auto& legacy = ConvertDependency(dependencyInfo);
+        vkCmdWaitEvents(
+            buffer,
+            1, &event,
+            legacy.SrcStages,
+            legacy.DstStages,
+            static_cast<u32>(legacy.MemoryBarriers.size()), legacy.MemoryBarriers.data(),
+            static_cast<u32>(legacy.BufferBarriers.size()), legacy.BufferBarriers.data(),
+            static_cast<u32>(legacy.ImageBarriers.size()), legacy.ImageBarriers.data()
+        );
+    }
+
+    void Synchronization::ResetEvent(VkCommandBuffer buffer, VkEvent event)
+    {
+        if (Context::Devices().SupportsSync2())
+        {
+            vkCmdResetEvent2KHR(buffer, event, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR);
+            return;
+        }
+
+        vkCmdResetEvent(buffer, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    }
+
+    void Synchronization::GlobalBarrier(VkCommandBuffer buffer, const VkMemoryBarrier2KHR& barrier)
+    {
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.memoryBarrierCount = 1;
+        dependencyInfo.pMemoryBarriers = &barrier;
+        PipelineBarrier(buffer, dependencyInfo);
+    }
+
+    void Synchronization::ImageBarrier(VkCommandBuffer buffer, const VkImageMemoryBarrier2KHR& barrier)
+    {
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.imageMemoryBarrierCount = 1;
+        dependencyInfo.pImageMemoryBarriers = &barrier;
+        PipelineBarrier(buffer, dependencyInfo);
+    }
+
+    void Synchronization::BufferBarrier(VkCommandBuffer buffer, const VkBufferMemoryBarrier2KHR& barrier)
+    {
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.bufferMemoryBarrierCount = 1;
+        dependencyInfo.pBufferMemoryBarriers = &barrier;
+        PipelineBarrier(buffer, dependencyInfo);
+    }
+
+    VkResult Synchronization::QueueSubmit(
+        VkQueue queue,
+        const VkSubmitInfo& submitInfo,
+        VkFence fence,
+        VkPipelineStageFlags2KHR signalStages)
+    {
+        return QueueSubmit(queue, &submitInfo, 1, fence, signalStages);
+    }
+
+    VkResult Synchronization::QueueSubmit(
+        VkQueue queue,
+        const VkSubmitInfo* submitInfos,
+        u32 submitCount,
+        VkFence fence,
+        VkPipelineStageFlags2KHR signalStages)
+    {
+        if (!Context::Devices().SupportsSync2())
+            return vkQueueSubmit(queue, submitCount, submitInfos, fence);
+
+        // Reused across calls so that submitting does not allocate every frame
+        thread_local static std::vector<VkSemaphoreSubmitInfoKHR> waitInfos;
+        thread_local static std::vector<VkSemaphoreSubmitInfoKHR> signalInfos;
+        thread_local static std::vector<VkCommandBufferSubmitInfoKHR> bufferInfos;
+        thread_local static std::vector<VkSubmitInfo2KHR> submitInfos2;
+
+        // Size everything up front so that the ranges referenced by each batch stay valid
+        u32 waitCount = 0;
+        u32 signalCount = 0;
+        u32 bufferCount = 0;
+        for (u32 submitIndex = 0; submitIndex < submitCount; submitIndex++)
+        {
+            waitCount += submitInfos[submitIndex].waitSemaphoreCount;
+            signalCount += submitInfos[submitIndex].signalSemaphoreCount;
+            bufferCount += submitInfos[submitIndex].commandBufferCount;
+        }
+        waitInfos.resize(waitCount);
+        signalInfos.resize(signalCount);
+        bufferInfos.resize(bufferCount);
+        submitInfos2.resize(submitCount);
+
+        u32 waitOffset = 0;
+        u32 signalOffset = 0;
+        u32 bufferOffset = 0;
+        for (u32 submitIndex = 0; submitIndex < submitCount; submitIndex++)
+        {
+            auto& submitInfo = submitInfos[submitIndex];
+
+            const VkTimelineSemaphoreSubmitInfo* timelineInfo = nullptr;
+            for (auto next = static_cast<const VkBaseInStructure*>(submitInfo.pNext); next; next = next->pNext)
+            {
+                if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+                {
+                    timelineInfo = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(next);
+                    break;
+                }
+            }
+
+            for (u32 i = 0; i < submitInfo.waitSemaphoreCount; i++)
+            {
+                auto& info = waitInfos[waitOffset + i];
+                info = {};
+                info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+                info.semaphore = submitInfo.pWaitSemaphores[i];
+                info.stageMask = submitInfo.pWaitDstStageMask[i];
+                if (timelineInfo && i < timelineInfo->waitSemaphoreValueCount)
+                    info.value = timelineInfo->pWaitSemaphoreValues[i];
+            }
+
+            for (u32 i = 0; i < submitInfo.signalSemaphoreCount; i++)
+            {
+                auto& info = signalInfos[signalOffset + i];
+                info = {};
+                info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+                info.semaphore = submitInfo.pSignalSemaphores[i];
+                info.stageMask = signalStages;
+                if (timelineInfo && i < timelineInfo->signalSemaphoreValueCount)
+                    info.value = timelineInfo->pSignalSemaphoreValues[i];
+            }
+
+            for (u32 i = 0; i < submitInfo.commandBufferCount; i++)
+            {
+                auto& info = bufferInfos[bufferOffset + i];
+                info = {};
+                info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+                info.commandBuffer = submitInfo.pCommandBuffers[i];
+            }
+
+            auto& submitInfo2 = submitInfos2[submitIndex];
+            submitInfo2 = {};
+            submitInfo2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+            submitInfo2.waitSemaphoreInfoCount = submitInfo.waitSemaphoreCount;
+            submitInfo2.pWaitSemaphoreInfos = waitInfos.data() + waitOffset;
+            submitInfo2.signalSemaphoreInfoCount = submitInfo.signalSemaphoreCount;
+            submitInfo2.pSignalSemaphoreInfos = signalInfos.data() + signalOffset;
+            submitInfo2.commandBufferInfoCount = submitInfo.commandBufferCount;
+            submitInfo2.pCommandBufferInfos = bufferInfos.data() + bufferOffset;
+
+            waitOffset += submitInfo.waitSemaphoreCount;
+            signalOffset += submitInfo.signalSemaphoreCount;
+            bufferOffset += submitInfo.commandBufferCount;
+        }
+
+        return vkQueueSubmit2KHR(queue, submitCount, submitInfos2.data(), fence);
+    }
+
+    VkPipelineStageFlags Synchronization::ConvertStageFlags(VkPipelineStageFlags2KHR flags)
+    {
+        // The first 32 bits of each synchronization2 stage match the legacy stages
+        VkPipelineStageFlags legacy = static_cast<VkPipelineStageFlags>(flags & 0xFFFFFFFF);
+
+        const VkPipelineStageFlags2KHR transferStages = VK_PIPELINE_STAGE_2_COPY_BIT_KHR |
+            VK_PIPELINE_STAGE_2_RESOLVE_BIT_KHR | VK_PIPELINE_STAGE_2_BLIT_BIT_KHR | VK_PIPELINE_STAGE_2_CLEAR_BIT_KHR;
+        if (flags & transferStages)
+            legacy |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+        if (flags & (VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT_KHR | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT_KHR))
+            legacy |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+        if (flags & VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT_KHR)
+            legacy |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+
+        return legacy;
+    }
+
+    VkAccessFlags Synchronization::ConvertAccessFlags(VkAccessFlags2KHR flags)
+    {
+        // The first 32 bits of each synchronization2 access match the legacy accesses
+        VkAccessFlags legacy = static_cast<VkAccessFlags>(flags & 0xFFFFFFFF);
+
+        if (flags & (VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR))
+            legacy |= VK_ACCESS_SHADER_READ_BIT;
+        if (flags & VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR)
+            legacy |= VK_ACCESS_SHADER_WRITE_BIT;
+
+        return legacy;
+    }
 }
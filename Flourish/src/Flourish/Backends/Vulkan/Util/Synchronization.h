@@ -22,5 +22,51 @@ namespace Flourish::Vulkan
         static void WaitForFences(const VkFence* fences, u32 count);
         static void ResetFences(const VkFence* fences, u32 count);
         static bool IsFenceSignalled(VkFence fence);
+
+        // TS
+        // Timeline semaphores are only available when Devices::SupportsTimelines
+        static u64 GetSemaphoreValue(VkSemaphore semaphore);
+        static void WaitForSemaphore(VkSemaphore semaphore, u64 value);
+
+        // TS
+        // Barriers are always described with synchronization2 structures. When the extension is
+        // unsupported they are converted to a single legacy vkCmdPipelineBarrier with the stage
+        // masks of every barrier combined
+        static void PipelineBarrier(VkCommandBuffer buffer, const VkDependencyInfoKHR& dependencyInfo);
+        static void GlobalBarrier(VkCommandBuffer buffer, const VkMemoryBarrier2KHR& barrier);
+        static void ImageBarrier(VkCommandBuffer buffer, const VkImageMemoryBarrier2KHR& barrier);
+        static void BufferBarrier(VkCommandBuffer buffer, const VkBufferMemoryBarrier2KHR& barrier);
+
+        // TS
+        // Halves of a split barrier. The wait must be given the same dependency as the set, and the
+        // event must be reset before it can be set again
+        static void SetEvent(VkCommandBuffer buffer, VkEvent event, const VkDependencyInfoKHR& dependencyInfo);
+        static void WaitEvent(VkCommandBuffer buffer, VkEvent event, const VkDependencyInfoKHR& dependencyInfo);
+        static void ResetEvent(VkCommandBuffer buffer, VkEvent event);
+
+        // TS
+        // Submits through vkQueueSubmit2 when synchronization2 is supported, which gives each
+        // semaphore its own stage mask. Timeline values are read from a chained
+        // VkTimelineSemaphoreSubmitInfo. Queue must be locked by the caller
+        static VkResult QueueSubmit(
+            VkQueue queue,
+            const VkSubmitInfo& submitInfo,
+            VkFence fence,
+            VkPipelineStageFlags2KHR signalStages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR
+        );
+
+        // TS
+        // Submits every batch in a single call. Queue must be locked by the caller
+        static VkResult QueueSubmit(
+            VkQueue queue,
+            const VkSubmitInfo* submitInfos,
+            u32 submitCount,
+            VkFence fence,
+            VkPipelineStageFlags2KHR signalStages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR
+        );
+
+        // Converts synchronization2 masks to their closest legacy equivalent
+        static VkPipelineStageFlags ConvertStageFlags(VkPipelineStageFlags2KHR flags);
+        static VkAccessFlags ConvertAccessFlags(VkAccessFlags2KHR flags);
     };
 }
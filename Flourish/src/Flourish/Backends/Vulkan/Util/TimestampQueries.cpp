@@ -0,0 +1,146 @@
+#include "flpch.h"
+#include "TimestampQueries.h"
+
+#include "Flourish/Backends/Vulkan/Context.h"
+#include "Flourish/Backends/Vulkan/RenderGraph.h"
+
+namespace Flourish::Vulkan
+{
+    void TimestampQueries::Initialize(const ContextInitializeInfo& initInfo)
+    {
+        FL_LOG_TRACE("Vulkan timestamp queries initialization begin");
+
+        if (!initInfo.AutomaticGraphTimestamps)
+            return;
+
+        if (!Context::Devices().PhysicalDeviceProperties().limits.timestampComputeAndGraphics)
+        {
+            FL_LOG_WARN("Automatic graph timestamps requested but the device does not support timestamps on all queues");
+            return;
+        }
+
+        m_Enabled = true;
+    }
+
+    void TimestampQueries::Shutdown()
+    {
+        FL_LOG_TRACE("Vulkan timestamp queries shutdown begin");
+
+        for (auto& frame : m_Frames)
+        {
+            for (VkQueryPool pool : frame.Pools)
+                vkDestroyQueryPool(Context::Devices().Device(), pool, nullptr);
+            frame.Pools.clear();
+            frame.Pending.clear();
+        }
+    }
+
+    void TimestampQueries::ResolveFrame()
+    {
+        if (!m_Enabled) return;
+
+        FL_PROFILE_FUNCTION();
+
+        std::lock_guard lock(m_Lock);
+
+        auto& frame = m_Frames[Flourish::Context::FrameIndex()];
+        if (frame.NextQuery == 0) return;
+
+        // Read back every pool in one go. The fences of this frame index have already been waited on,
+        // so this never blocks
+        m_ResultBuffer.resize(frame.NextQuery * 2);
+        for (u32 poolIndex = 0; poolIndex * QueriesPerPool < frame.NextQuery; poolIndex++)
+        {
+            u32 firstQuery = poolIndex * QueriesPerPool;
+            u32 queryCount = std::min(QueriesPerPool, frame.NextQuery - firstQuery);
+
+            // Results are written as (value, availability) pairs
+            vkGetQueryPoolResults(
+                Context::Devices().Device(),
+                frame.Pools[poolIndex],
+                0, queryCount,
+                queryCount * sizeof(u64) * 2,
+                m_ResultBuffer.data() + firstQuery * 2,
+                sizeof(u64) * 2,
+                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT
+            );
+        }
+
+        d64 period = (d64)Context::Devices().PhysicalDeviceProperties().limits.timestampPeriod;
+        for (auto& pending : frame.Pending)
+        {
+            if (!pending.Graph)
+                continue;
+
+            u64* start = m_ResultBuffer.data() + pending.QueryIndex * 2;
+            u64* end = start + 2;
+            if (!start[1] || !end[1])
+                continue;
+
+            pending.Graph->StoreTimestamp(
+                pending.Frame,
+                pending.NodeId,
+                pending.EncoderIndex,
+                (d64)start[0] * period,
+                (d64)end[0] * period
+            );
+        }
+
+        frame.Pending.clear();
+        frame.NextQuery = 0;
+    }
+
+    bool TimestampQueries::Allocate(RenderGraph* graph, u64 nodeId, u32 encoderIndex, TimestampAllocation& outAllocation)
+    {
+        if (!m_Enabled) return false;
+
+        std::lock_guard lock(m_Lock);
+
+        auto& frame = m_Frames[Flourish::Context::FrameIndex()];
+
+        // Pairs never straddle two pools since the pool size is even
+        u32 queryIndex = frame.NextQuery;
+        u32 poolIndex = queryIndex / QueriesPerPool;
+        if (poolIndex >= frame.Pools.size())
+        {
+            VkQueryPoolCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            createInfo.queryCount = QueriesPerPool;
+
+            VkQueryPool pool;
+            if (!FL_VK_CHECK_RESULT(vkCreateQueryPool(
+                Context::Devices().Device(),
+                &createInfo,
+                nullptr,
+                &pool
+            ), "Create timestamp query pool"))
+                return false;
+
+            frame.Pools.emplace_back(pool);
+        }
+
+        frame.NextQuery += 2;
+        frame.Pending.push_back({ graph, nodeId, encoderIndex, queryIndex, Flourish::Context::FrameCount() });
+
+        outAllocation.Pool = frame.Pools[poolIndex];
+        outAllocation.Index = queryIndex % QueriesPerPool;
+
+        return true;
+    }
+
+    void TimestampQueries::ForgetGraph(RenderGraph* graph)
+    {
+        if (!m_Enabled) return;
+
+        std::lock_guard lock(m_Lock);
+
+        for (auto& frame : m_Frames)
+        {
+            // The queries themselves stay allocated until the frame resolves
+            for (auto& pending : frame.Pending)
+                if (pending.Graph == graph)
+                    pending.Graph = nullptr;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Flourish/Backends/Vulkan/Util/Common.h"
+
+namespace Flourish::Vulkan
+{
+    struct TimestampAllocation
+    {
+        VkQueryPool Pool = VK_NULL_HANDLE;
+        u32 Index = 0; // Start query, end query is Index + 1
+    };
+
+    class RenderGraph;
+    class TimestampQueries
+    {
+    public:
+        void Initialize(const ContextInitializeInfo& initInfo);
+        void Shutdown();
+
+        // Reads back the queries written FrameBufferCount frames ago into their graphs. Must be
+        // called once the fences for the current frame index have been waited on
+        void ResolveFrame();
+
+        // TS
+        // Allocates a start/end query pair for a graph encoder in the current frame. The pair must be
+        // reset on the command buffer before it is written
+        bool Allocate(RenderGraph* graph, u64 nodeId, u32 encoderIndex, TimestampAllocation& outAllocation);
+        void ForgetGraph(RenderGraph* graph);
+
+        // TS
+        inline bool IsEnabled() const { return m_Enabled; }
+
+    private:
+        struct PendingQuery
+        {
+            RenderGraph* Graph;
+            u64 NodeId;
+            u32 EncoderIndex;
+            u32 QueryIndex;
+            u64 Frame;
+        };
+
+        struct FrameQueries
+        {
+            std::vector<VkQueryPool> Pools;
+            std::vector<PendingQuery> Pending;
+            u32 NextQuery = 0;
+        };
+
+    private:
+        bool m_Enabled = false;
+        std::array<FrameQueries, Flourish::Context::MaxFrameBufferCount> m_Frames;
+        std::vector<u64> m_ResultBuffer;
+        std::mutex m_Lock;
+
+        static constexpr u32 QueriesPerPool = 512;
+    };
+}
@@ -0,0 +1,115 @@
+#include "flpch.h"
+#include "WorkerPool.h"
+
+#include "Flourish/Backends/Vulkan/Context.h"
+
+namespace Flourish::Vulkan
+{
+    void WorkerPool::Initialize(const ContextInitializeInfo& initInfo)
+    {
+        FL_LOG_TRACE("Vulkan worker pool initialization begin");
+
+        m_Stopping = false;
+        for (u32 i = 0; i < initInfo.SubmissionRecordingThreads; i++)
+            m_Threads.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+
+    void WorkerPool::Shutdown()
+    {
+        FL_LOG_TRACE("Vulkan worker pool shutdown begin");
+
+        {
+            std::lock_guard lock(m_Lock);
+            m_Stopping = true;
+        }
+        m_WorkAvailable.notify_all();
+
+        // Exiting threads hand their command pools back to Commands, so this must happen before it shuts down
+        for (auto& thread : m_Threads)
+            thread.join();
+        m_Threads.clear();
+    }
+
+    void WorkerPool::Run(u32 taskCount, const std::function<void(u32)>& task)
+    {
+        std::unique_lock runLock(m_RunLock, std::try_to_lock);
+        if (m_Threads.empty() || taskCount <= 1 || !runLock.owns_lock())
+        {
+            for (u32 i = 0; i < taskCount; i++)
+                task(i);
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_Lock);
+            m_Task = &task;
+            m_TaskCount = taskCount;
+            m_NextTask = 0;
+            m_ActiveWorkers = static_cast<u32>(m_Threads.size());
+            m_Batch++;
+        }
+        m_WorkAvailable.notify_all();
+
+        ExecuteTasks();
+
+        std::exception_ptr error;
+        {
+            std::unique_lock lock(m_Lock);
+            m_WorkFinished.wait(lock, [this]() { return m_ActiveWorkers == 0; });
+            m_Task = nullptr;
+            error = m_TaskError;
+            m_TaskError = nullptr;
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void WorkerPool::WorkerLoop()
+    {
+        u64 lastBatch = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_Lock);
+                m_WorkAvailable.wait(lock, [this, lastBatch]() { return m_Stopping || m_Batch != lastBatch; });
+                if (m_Stopping)
+                    break;
+                lastBatch = m_Batch;
+            }
+
+            ExecuteTasks();
+
+            {
+                std::lock_guard lock(m_Lock);
+                m_ActiveWorkers--;
+            }
+            m_WorkFinished.notify_one();
+        }
+    }
+
+    void WorkerPool::ExecuteTasks()
+    {
+        FL_PROFILE_FUNCTION();
+
+        while (true)
+        {
+            u32 taskIndex = m_NextTask.fetch_add(1);
+            if (taskIndex >= m_TaskCount)
+                break;
+
+            // Worker threads cannot propagate errors themselves, so the first one is kept for Run and the
+            // remaining tasks still execute to leave the batch in a consistent state
+            try
+            {
+                (*m_Task)(taskIndex);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_Lock);
+                if (!m_TaskError)
+                    m_TaskError = std::current_exception();
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Flourish/Backends/Vulkan/Util/Common.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+
+namespace Flourish::Vulkan
+{
+    // Persistent threads that split a batch of independent tasks with the calling thread. Each worker
+    // allocates from its own command pools, so tasks are free to record command buffers
+    class WorkerPool
+    {
+    public:
+        void Initialize(const ContextInitializeInfo& initInfo);
+        void Shutdown();
+
+        // TS
+        // Runs the task for every index in [0, taskCount) and returns once all of them are done. Tasks run
+        // on the calling thread instead when there are no workers or another batch is in progress. Errors thrown
+        // by tasks reach the caller, and when they run on workers the first one is rethrown once the batch finishes
+        void Run(u32 taskCount, const std::function<void(u32)>& task);
+
+        // TS
+        inline u32 ThreadCount() const { return static_cast<u32>(m_Threads.size()); }
+
+    private:
+        void WorkerLoop();
+        void ExecuteTasks();
+
+    private:
+        std::vector<std::thread> m_Threads;
+        std::mutex m_RunLock;
+
+        // Current batch, guarded by m_Lock
+        std::mutex m_Lock;
+        std::condition_variable m_WorkAvailable;
+        std::condition_variable m_WorkFinished;
+        const std::function<void(u32)>* m_Task = nullptr;
+        u32 m_TaskCount = 0;
+        u32 m_ActiveWorkers = 0;
+        u64 m_Batch = 0;
+        bool m_Stopping = false;
+        std::exception_ptr m_TaskError;
+
+        std::atomic<u32> m_NextTask = 0;
+    };
+}
@@ -32,7 +32,6 @@
 	#define FL_PLATFORM_ANDROID
 #elif defined(__linux__)
 	#define FL_PLATFORM_LINUX
-	#error "Linux is not supported!"
 #else
 	/* Unknown compiler/platform */
 	#error "Unknown platform!"
@@ -0,0 +1,301 @@
+#include "flpch.h"
+#include "Profiler.h"
+
+#include <chrono>
+
+namespace Flourish
+{
+    namespace
+    {
+        enum class TraceEventType : u8
+        {
+            Begin = 0,
+            End,
+            Counter
+        };
+
+        struct TraceEvent
+        {
+            const char* Name;
+            u64 Time;
+            s64 Value;
+            TraceEventType Type;
+        };
+
+        // Only ever written by its owning thread. The exporter reads up to Count once the
+        // buffer's generation matches the current recording
+        struct ThreadBuffer
+        {
+            std::vector<TraceEvent> Events;
+            std::atomic<u32> Count = 0;
+            std::atomic<u32> Generation = 0;
+            std::atomic<u32> Dropped = 0;
+            u32 Depth = 0;
+            u32 SkippedDepth = 0;
+            u32 ThreadIndex = 0;
+        };
+
+        struct RecorderState
+        {
+            std::mutex Lock;
+            std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+            std::atomic<u32> Generation = 0;
+            u32 EventsPerThread = 0;
+            std::chrono::steady_clock::time_point StartTime;
+        };
+
+        RecorderState& Recorder()
+        {
+            static RecorderState recorder;
+            return recorder;
+        }
+
+        thread_local ThreadBuffer* t_Buffer = nullptr;
+
+        ThreadBuffer* GetThreadBuffer()
+        {
+            auto& recorder = Recorder();
+            u32 generation = recorder.Generation.load(std::memory_order_acquire);
+
+            ThreadBuffer* buffer = t_Buffer;
+            if (!buffer)
+            {
+                std::lock_guard lock(recorder.Lock);
+                buffer = recorder.Buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+                buffer->ThreadIndex = static_cast<u32>(recorder.Buffers.size() - 1);
+                t_Buffer = buffer;
+            }
+
+            // Lazily reset on the first event of a new recording so that only the owning thread
+            // ever touches the event storage
+            if (buffer->Generation.load(std::memory_order_relaxed) != generation)
+            {
+                buffer->Events.resize(recorder.EventsPerThread);
+                buffer->Count.store(0, std::memory_order_relaxed);
+                buffer->Dropped.store(0, std::memory_order_relaxed);
+                buffer->Depth = 0;
+                buffer->SkippedDepth = 0;
+                buffer->Generation.store(generation, std::memory_order_release);
+            }
+
+            return buffer;
+        }
+
+        void PushEvent(ThreadBuffer* buffer, TraceEventType type, const char* name, s64 value)
+        {
+            u64 time = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - Recorder().StartTime
+            ).count());
+
+            u32 index = buffer->Count.load(std::memory_order_relaxed);
+            buffer->Events[index] = { name, time, value, type };
+            buffer->Count.store(index + 1, std::memory_order_release);
+        }
+
+        void RecordBegin(const char* name)
+        {
+            ThreadBuffer* buffer = GetThreadBuffer();
+
+            // Always leave room for the end events of every open zone so the trace stays balanced
+            u32 count = buffer->Count.load(std::memory_order_relaxed);
+            if (buffer->SkippedDepth > 0 || count + buffer->Depth + 1 >= buffer->Events.size())
+            {
+                buffer->SkippedDepth++;
+                buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            buffer->Depth++;
+            PushEvent(buffer, TraceEventType::Begin, name, 0);
+        }
+
+        void RecordEnd()
+        {
+            ThreadBuffer* buffer = GetThreadBuffer();
+            if (buffer->SkippedDepth > 0)
+            {
+                buffer->SkippedDepth--;
+                return;
+            }
+
+            // Zone was opened before the recording started
+            if (buffer->Depth == 0)
+                return;
+
+            buffer->Depth--;
+            PushEvent(buffer, TraceEventType::End, nullptr, 0);
+        }
+
+        void RecordCounter(const char* name, s64 value)
+        {
+            ThreadBuffer* buffer = GetThreadBuffer();
+
+            u32 count = buffer->Count.load(std::memory_order_relaxed);
+            if (count + buffer->Depth + 1 >= buffer->Events.size())
+            {
+                buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            PushEvent(buffer, TraceEventType::Counter, name, value);
+        }
+
+        void AppendEscaped(std::string& out, const char* str)
+        {
+            for (; *str; str++)
+            {
+                if (*str == '"' || *str == '\\')
+                    out.push_back('\\');
+                out.push_back(*str);
+            }
+        }
+    }
+
+    void Profiler::SetHooks(const ProfilerHooks& hooks)
+    {
+        s_Hooks = hooks;
+        UpdateActive();
+    }
+
+    void Profiler::ClearHooks()
+    {
+        s_Hooks = ProfilerHooks();
+        UpdateActive();
+    }
+
+    void Profiler::StartRecording(u32 eventsPerThread)
+    {
+        if (s_Recording)
+        {
+            FL_LOG_WARN("Profiler recording is already in progress");
+            return;
+        }
+
+        auto& recorder = Recorder();
+        recorder.EventsPerThread = std::max(eventsPerThread, 2u);
+        recorder.StartTime = std::chrono::steady_clock::now();
+        recorder.Generation.fetch_add(1, std::memory_order_release);
+
+        s_Recording = true;
+        UpdateActive();
+    }
+
+    void Profiler::StopRecording()
+    {
+        s_Recording = false;
+        UpdateActive();
+    }
+
+    std::string Profiler::GetRecordingJson()
+    {
+        auto& recorder = Recorder();
+        u32 generation = recorder.Generation.load(std::memory_order_acquire);
+
+        std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        char buffer[128];
+
+        std::lock_guard lock(recorder.Lock);
+        for (auto& threadBuffer : recorder.Buffers)
+        {
+            if (threadBuffer->Generation.load(std::memory_order_acquire) != generation)
+                continue;
+
+            u32 count = threadBuffer->Count.load(std::memory_order_acquire);
+            if (count == 0)
+                continue;
+
+            u32 dropped = threadBuffer->Dropped.load(std::memory_order_relaxed);
+            if (dropped > 0)
+                FL_LOG_WARN("Profiler thread %d dropped %d events, consider increasing eventsPerThread", threadBuffer->ThreadIndex, dropped);
+
+            if (!first) json += ',';
+            first = false;
+            snprintf(
+                buffer, sizeof(buffer),
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+                threadBuffer->ThreadIndex, threadBuffer->ThreadIndex
+            );
+            json += buffer;
+
+            for (u32 i = 0; i < count; i++)
+            {
+                auto& event = threadBuffer->Events[i];
+                d64 timeUs = static_cast<d64>(event.Time) / 1000.0;
+
+                json += ',';
+                switch (event.Type)
+                {
+                    case TraceEventType::Begin:
+                    {
+                        json += "{\"name\":\"";
+                        AppendEscaped(json, event.Name);
+                        snprintf(buffer, sizeof(buffer), "\",\"ph\":\"B\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", threadBuffer->ThreadIndex, timeUs);
+                        json += buffer;
+                    } break;
+                    case TraceEventType::End:
+                    {
+                        snprintf(buffer, sizeof(buffer), "{\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", threadBuffer->ThreadIndex, timeUs);
+                        json += buffer;
+                    } break;
+                    case TraceEventType::Counter:
+                    {
+                        json += "{\"name\":\"";
+                        AppendEscaped(json, event.Name);
+                        snprintf(
+                            buffer, sizeof(buffer),
+                            "\",\"ph\":\"C\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%lld}}",
+                            threadBuffer->ThreadIndex, timeUs, static_cast<long long>(event.Value)
+                        );
+                        json += buffer;
+                    } break;
+                }
+            }
+        }
+
+        json += "]}";
+        return json;
+    }
+
+    bool Profiler::WriteRecording(const std::filesystem::path& path)
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            FL_LOG_ERROR("Failed to open profiler output file %s", path.generic_string().c_str());
+            return false;
+        }
+
+        file << GetRecordingJson();
+        return true;
+    }
+
+    void Profiler::BeginZone(const char* name)
+    {
+        if (s_Hooks.BeginZone)
+            s_Hooks.BeginZone(name, s_Hooks.UserData);
+        if (s_Recording.load(std::memory_order_relaxed))
+            RecordBegin(name);
+    }
+
+    void Profiler::EndZone()
+    {
+        if (s_Hooks.EndZone)
+            s_Hooks.EndZone(s_Hooks.UserData);
+        if (s_Recording.load(std::memory_order_relaxed))
+            RecordEnd();
+    }
+
+    void Profiler::Counter(const char* name, s64 value)
+    {
+        if (s_Hooks.Counter)
+            s_Hooks.Counter(name, value, s_Hooks.UserData);
+        if (s_Recording.load(std::memory_order_relaxed))
+            RecordCounter(name, value);
+    }
+
+    void Profiler::UpdateActive()
+    {
+        s_Active = s_Recording || s_Hooks.BeginZone || s_Hooks.Counter;
+    }
+}
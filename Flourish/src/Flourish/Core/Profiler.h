@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+
+namespace Flourish
+{
+    // Names passed to the hooks must be string literals or otherwise outlive the profiler
+    struct ProfilerHooks
+    {
+        void (*BeginZone)(const char* name, void* userData) = nullptr;
+        void (*EndZone)(void* userData) = nullptr;
+        void (*Counter)(const char* name, s64 value, void* userData) = nullptr;
+        void* UserData = nullptr;
+    };
+
+    class Profiler
+    {
+    public:
+        // Not thread safe with respect to active zones, so these should be set at startup or
+        // between frames
+        static void SetHooks(const ProfilerHooks& hooks);
+        static void ClearHooks();
+
+        // Built-in recorder which buffers events per thread without locking. Events past
+        // eventsPerThread are dropped. Start and stop should be called between frames
+        static void StartRecording(u32 eventsPerThread = 1 << 16);
+        static void StopRecording();
+
+        // Exports the last recording in the Chrome trace event format, which can be opened in
+        // chrome://tracing or ui.perfetto.dev
+        static std::string GetRecordingJson();
+        static bool WriteRecording(const std::filesystem::path& path);
+
+        // TS
+        static void BeginZone(const char* name);
+        static void EndZone();
+        static void Counter(const char* name, s64 value);
+        inline static bool IsActive() { return s_Active.load(std::memory_order_relaxed); }
+
+    private:
+        static void UpdateActive();
+
+    private:
+        inline static std::atomic<bool> s_Active = false;
+        inline static std::atomic<bool> s_Recording = false;
+        inline static ProfilerHooks s_Hooks;
+    };
+
+    class ProfilerZone
+    {
+    public:
+        ProfilerZone(const char* name)
+            : m_Active(Profiler::IsActive())
+        { if (m_Active) Profiler::BeginZone(name); }
+        ~ProfilerZone()
+        { if (m_Active) Profiler::EndZone(); }
+
+        ProfilerZone(const ProfilerZone&) = delete;
+        ProfilerZone& operator=(const ProfilerZone&) = delete;
+
+    private:
+        bool m_Active;
+    };
+}
+
+#define FL_PROFILE_CONCAT_INNER(a, b) a##b
+#define FL_PROFILE_CONCAT(a, b) FL_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef FL_PROFILER_HOOKS
+    #define FL_PROFILE_HOOK_SCOPE(name) ::Flourish::ProfilerZone FL_PROFILE_CONCAT(_flProfilerZone, __LINE__)(name)
+    #define FL_PROFILE_HOOK_COUNTER(name, value) \
+        { if (::Flourish::Profiler::IsActive()) ::Flourish::Profiler::Counter(name, static_cast<s64>(value)); }
+#else
+    #define FL_PROFILE_HOOK_SCOPE(name)
+    #define FL_PROFILE_HOOK_COUNTER(name, value) {}
+#endif
@@ -11,9 +11,13 @@
 #ifdef FL_USE_TRACY
     #define TRACY_ENABLE
     #include "tracy/Tracy.hpp"
-    #define FL_PROFILE_FUNCTION() ZoneScoped
+    #define FL_PROFILE_TRACY_FUNCTION() ZoneScoped
+    #define FL_PROFILE_TRACY_SCOPE(name) ZoneScopedN(name)
+    #define FL_PROFILE_TRACY_COUNTER(name, value) TracyPlot(name, static_cast<int64_t>(value))
 #else
-    #define FL_PROFILE_FUNCTION()
+    #define FL_PROFILE_TRACY_FUNCTION()
+    #define FL_PROFILE_TRACY_SCOPE(name)
+    #define FL_PROFILE_TRACY_COUNTER(name, value)
 #endif
 
 #if defined(FL_HAS_AFTERMATH) && defined(FL_DEBUG)
@@ -38,6 +42,11 @@
 #include "Flourish/Core/Base.h"
 #include "Flourish/Core/Log.h"
 #include "Flourish/Core/Assert.h"
+#include "Flourish/Core/Profiler.h"
+
+#define FL_PROFILE_FUNCTION() FL_PROFILE_TRACY_FUNCTION(); FL_PROFILE_HOOK_SCOPE(__FUNCTION__)
+#define FL_PROFILE_SCOPE(name) FL_PROFILE_TRACY_SCOPE(name); FL_PROFILE_HOOK_SCOPE(name)
+#define FL_PROFILE_COUNTER(name, value) FL_PROFILE_TRACY_COUNTER(name, value); FL_PROFILE_HOOK_COUNTER(name, value)
 
 #ifdef FL_PLATFORM_WINDOWS
 	#include <Windows.h>
@@ -0,0 +1,452 @@
+#include "flpch.h"
+#include "Benchmarks.h"
+
+#include "Flourish/Api/RenderCommandEncoder.h"
+#include "Flourish/Api/ComputeCommandEncoder.h"
+#include "Flourish/Api/GraphicsCommandEncoder.h"
+#include "Flourish/Backends/Vulkan/Context.h"
+
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+namespace FlourishBench
+{
+    using Clock = std::chrono::steady_clock;
+
+    inline static u64 ElapsedNs(Clock::time_point start)
+    {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    u64 BenchmarkResult::Min() const
+    {
+        return *std::min_element(Samples.begin(), Samples.end());
+    }
+
+    u64 BenchmarkResult::Median() const
+    {
+        std::vector<u64> sorted = Samples;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+
+    u64 BenchmarkResult::Mean() const
+    {
+        u64 total = 0;
+        for (u64 sample : Samples)
+            total += sample;
+        return total / Samples.size();
+    }
+
+    Benchmarks::Benchmarks(const BenchmarkConfig& config)
+        : m_Config(config)
+    {
+        for (u32 size : { 10, 100, 1000, 10000, 100000 })
+            if (size <= m_Config.MaxSize)
+                m_Sizes.push_back(size);
+        if (m_Config.Iterations == 0)
+            m_Config.Iterations = 1;
+
+        CreateRenderPasses();
+        CreateBuffers();
+        CreateFramebuffers();
+        CreatePipelines();
+    }
+
+    void Benchmarks::Run()
+    {
+        RunBenchmark("RenderGraph::Build", &Benchmarks::RenderGraphBuild);
+        RunBenchmark("RenderGraph::Build (diamond lattice)", &Benchmarks::RenderGraphBuildDiamond);
+        RunBenchmark("RenderGraph::Build (unchanged topology)", &Benchmarks::RenderGraphRebuildUnchanged);
+        RunBenchmark("RenderGraph::ProcessGraph", &Benchmarks::RenderGraphProcess);
+        RunBenchmark("ResourceSet::FlushBindings", &Benchmarks::ResourceSetFlush);
+        RunBenchmark("RenderCommandEncoder::Draw", &Benchmarks::DrawRecording);
+        RunBenchmark("Buffer::SetBytes", &Benchmarks::BufferSetBytes);
+        RunBenchmark("FinalizerQueue::Iterate", &Benchmarks::FinalizerIterate);
+    }
+
+    std::string Benchmarks::ToJson() const
+    {
+        std::stringstream out;
+        out << "{\n";
+        out << "  \"frameBufferCount\": " << Flourish::Context::FrameBufferCount() << ",\n";
+        out << "  \"results\": [\n";
+        for (u32 i = 0; i < m_Results.size(); i++)
+        {
+            auto& result = m_Results[i];
+            u64 median = result.Median();
+            out << "    { ";
+            out << "\"name\": \"" << result.Name << "\", ";
+            out << "\"size\": " << result.Size << ", ";
+            out << "\"iterations\": " << result.Samples.size() << ", ";
+            out << "\"min_ns\": " << result.Min() << ", ";
+            out << "\"median_ns\": " << median << ", ";
+            out << "\"mean_ns\": " << result.Mean() << ", ";
+            out << "\"per_item_ns\": " << static_cast<d64>(median) / result.Size;
+            out << " }" << (i == m_Results.size() - 1 ? "\n" : ",\n");
+        }
+        out << "  ]\n";
+        out << "}\n";
+
+        return out.str();
+    }
+
+    void Benchmarks::RunBenchmark(const char* name, u64 (Benchmarks::*func)(u32))
+    {
+        for (u32 size : m_Sizes)
+        {
+            FL_LOG_INFO("Running benchmark %s (size %d)", name, size);
+
+            EnsureCommandBuffers(size);
+
+            // Warmup so that lazily created pools and caches are not measured
+            (this->*func)(size);
+
+            auto& result = m_Results.emplace_back();
+            result.Name = name;
+            result.Size = size;
+            for (u32 i = 0; i < m_Config.Iterations; i++)
+                result.Samples.push_back((this->*func)(size));
+
+            // Let any deferred work from this benchmark retire before the next one starts
+            AdvanceFrames(Flourish::Context::FrameBufferCount() * 2 + 2);
+        }
+    }
+
+    void Benchmarks::EnsureCommandBuffers(u32 count)
+    {
+        Flourish::CommandBufferCreateInfo cmdCreateInfo;
+        cmdCreateInfo.FrameRestricted = true;
+        while (m_CommandBuffers.size() < count)
+            m_CommandBuffers.push_back(Flourish::CommandBuffer::Create(cmdCreateInfo));
+    }
+
+    void Benchmarks::AdvanceFrames(u32 count)
+    {
+        for (u32 i = 0; i < count; i++)
+        {
+            Flourish::Context::BeginFrame();
+            Flourish::Context::EndFrame();
+        }
+    }
+
+    // Chain of nodes alternating between graphics and compute in blocks of eight. Each node
+    // reads the buffer written by the previous node so that every resource path in the
+    // build is exercised
+    static void PopulateChainGraph(
+        Flourish::RenderGraph* graph,
+        const std::vector<std::shared_ptr<Flourish::CommandBuffer>>& buffers,
+        const std::vector<std::shared_ptr<Flourish::Buffer>>& resources,
+        u32 size)
+    {
+        for (u32 i = 0; i < size; i++)
+        {
+            auto workload = (i / 8) % 2 ? Flourish::GPUWorkloadType::Compute : Flourish::GPUWorkloadType::Graphics;
+            auto builder = graph->ConstructNewNode(buffers[i].get());
+            builder.AddEncoderNode(workload)
+                .EncoderAddBufferWrite(resources[i % resources.size()].get());
+            if (i > 0)
+            {
+                builder.AddExecutionDependency(buffers[i - 1].get())
+                    .EncoderAddBufferRead(resources[(i - 1) % resources.size()].get());
+            }
+            builder.AddToGraph();
+        }
+    }
+
+    // Lattice of width nodes per layer where each node depends on two neighbours in the previous
+    // layer. The number of distinct paths to the first layer grows exponentially with depth, which
+    // is the worst case for any ordering that walks paths instead of edges
+    static void PopulateDiamondGraph(
+        Flourish::RenderGraph* graph,
+        const std::vector<std::shared_ptr<Flourish::CommandBuffer>>& buffers,
+        const std::vector<std::shared_ptr<Flourish::Buffer>>& resources,
+        u32 size,
+        u32 width)
+    {
+        for (u32 i = 0; i < size; i++)
+        {
+            u32 layer = i / width;
+            u32 column = i % width;
+            auto workload = layer % 4 == 3 ? Flourish::GPUWorkloadType::Compute : Flourish::GPUWorkloadType::Graphics;
+            auto builder = graph->ConstructNewNode(buffers[i].get());
+            builder.AddEncoderNode(workload)
+                .EncoderAddBufferWrite(resources[i % resources.size()].get());
+            if (layer > 0)
+            {
+                u32 left = (layer - 1) * width + column;
+                u32 right = (layer - 1) * width + (column + 1) % width;
+                builder.AddExecutionDependency(buffers[left].get())
+                    .AddExecutionDependency(buffers[right].get())
+                    .EncoderAddBufferRead(resources[left % resources.size()].get())
+                    .EncoderAddBufferRead(resources[right % resources.size()].get());
+            }
+            builder.AddToGraph();
+        }
+    }
+
+    u64 Benchmarks::RenderGraphBuild(u32 size)
+    {
+        Flourish::RenderGraphCreateInfo rgCreateInfo;
+        rgCreateInfo.Usage = Flourish::RenderGraphUsageType::BuildPerFrame;
+        auto graph = Flourish::RenderGraph::Create(rgCreateInfo);
+
+        // Populating is part of the per-frame cost for BuildPerFrame graphs
+        auto start = Clock::now();
+        PopulateChainGraph(graph.get(), m_CommandBuffers, m_GraphBuffers, size);
+        graph->Build();
+        return ElapsedNs(start);
+    }
+
+    u64 Benchmarks::RenderGraphBuildDiamond(u32 size)
+    {
+        Flourish::RenderGraphCreateInfo rgCreateInfo;
+        rgCreateInfo.Usage = Flourish::RenderGraphUsageType::BuildPerFrame;
+        auto graph = Flourish::RenderGraph::Create(rgCreateInfo);
+
+        auto start = Clock::now();
+        PopulateDiamondGraph(graph.get(), m_CommandBuffers, m_GraphBuffers, size, DiamondWidth);
+        graph->Build();
+        return ElapsedNs(start);
+    }
+
+    // Same graph declared again every frame, which is the common case for BuildPerFrame graphs.
+    // The warmup iteration performs the full build so that the timed ones hit the topology hash
+    u64 Benchmarks::RenderGraphRebuildUnchanged(u32 size)
+    {
+        if (!m_RebuildGraph || m_RebuildGraph->GetNodeCount() != size)
+        {
+            Flourish::RenderGraphCreateInfo rgCreateInfo;
+            rgCreateInfo.Usage = Flourish::RenderGraphUsageType::BuildPerFrame;
+            m_RebuildGraph = Flourish::RenderGraph::Create(rgCreateInfo);
+        }
+
+        auto start = Clock::now();
+        m_RebuildGraph->Clear();
+        PopulateChainGraph(m_RebuildGraph.get(), m_CommandBuffers, m_GraphBuffers, size);
+        m_RebuildGraph->Build();
+        return ElapsedNs(start);
+    }
+
+    // ProcessGraph is internal to the submission handler, so it is measured through EndFrame
+    // with a graph whose encoders record no commands
+    u64 Benchmarks::RenderGraphProcess(u32 size)
+    {
+        Flourish::RenderGraphCreateInfo rgCreateInfo;
+        rgCreateInfo.Usage = Flourish::RenderGraphUsageType::PerFrame;
+        auto graph = Flourish::RenderGraph::Create(rgCreateInfo);
+        PopulateChainGraph(graph.get(), m_CommandBuffers, m_GraphBuffers, size);
+        graph->Build();
+
+        Flourish::Context::BeginFrame();
+        for (u32 i = 0; i < size; i++)
+        {
+            if ((i / 8) % 2)
+            {
+                auto encoder = m_CommandBuffers[i]->EncodeComputeCommands();
+                encoder->EndEncoding();
+            }
+            else
+            {
+                auto encoder = m_CommandBuffers[i]->EncodeGraphicsCommands();
+                encoder->EndEncoding();
+            }
+        }
+        Flourish::Context::PushFrameRenderGraph(graph.get());
+
+        auto start = Clock::now();
+        Flourish::Context::EndFrame();
+        return ElapsedNs(start);
+    }
+
+    u64 Benchmarks::ResourceSetFlush(u32 size)
+    {
+        Flourish::Context::BeginFrame();
+
+        auto start = Clock::now();
+        for (u32 i = 0; i < size; i++)
+        {
+            m_ComputeResourceSet->BindBuffer(0, m_StorageBuffer, 0, m_StorageBuffer->GetAllocatedCount());
+            m_ComputeResourceSet->FlushBindings();
+        }
+        u64 elapsed = ElapsedNs(start);
+
+        Flourish::Context::EndFrame();
+
+        return elapsed;
+    }
+
+    u64 Benchmarks::DrawRecording(u32 size)
+    {
+        Flourish::RenderGraphCreateInfo rgCreateInfo;
+        rgCreateInfo.Usage = Flourish::RenderGraphUsageType::Once;
+        auto graph = Flourish::RenderGraph::Create(rgCreateInfo);
+        graph->ConstructNewNode(m_CommandBuffers[0].get())
+            .AddEncoderNode(Flourish::GPUWorkloadType::Graphics)
+            .EncoderAddFramebuffer(m_Framebuffer.get())
+            .AddToGraph();
+        graph->Build();
+
+        Flourish::Context::BeginFrame();
+
+        auto start = Clock::now();
+        auto encoder = m_CommandBuffers[0]->EncodeRenderCommands(m_Framebuffer.get());
+        encoder->BindPipeline("draw");
+        for (u32 i = 0; i < size; i++)
+            encoder->Draw(3, 0, 1, 0);
+        encoder->EndEncoding();
+        u64 elapsed = ElapsedNs(start);
+
+        Flourish::Context::PushFrameRenderGraph(graph.get());
+        Flourish::Context::EndFrame();
+
+        return elapsed;
+    }
+
+    u64 Benchmarks::BufferSetBytes(u32 size)
+    {
+        std::array<unsigned char, UploadChunkSize> data;
+        data.fill(0xFF);
+
+        u32 chunkCount = m_UploadBuffer->GetAllocatedCount();
+        auto start = Clock::now();
+        for (u32 i = 0; i < size; i++)
+            m_UploadBuffer->SetBytes(data.data(), UploadChunkSize, (i % chunkCount) * UploadChunkSize);
+        return ElapsedNs(start);
+    }
+
+    u64 Benchmarks::FinalizerIterate(u32 size)
+    {
+        auto& queue = Flourish::Vulkan::Context::FinalizerQueue();
+
+        u32 executed = 0;
+        for (u32 i = 0; i < size; i++)
+            queue.Push([&executed]() { executed++; });
+
+        auto start = Clock::now();
+        while (!queue.IsEmpty())
+            queue.Iterate();
+        u64 elapsed = ElapsedNs(start);
+
+        FL_ASSERT(executed == size, "Finalizer did not execute every entry");
+
+        return elapsed;
+    }
+
+    void Benchmarks::CreateRenderPasses()
+    {
+        Flourish::RenderPassCreateInfo rpCreateInfo;
+        rpCreateInfo.ColorAttachments = {
+            { Flourish::ColorFormat::RGBA8_UNORM }
+        };
+        rpCreateInfo.Subpasses = {
+            { {}, { { Flourish::SubpassAttachmentType::Color, 0 } } }
+        };
+        m_RenderPass = Flourish::RenderPass::Create(rpCreateInfo);
+    }
+
+    void Benchmarks::CreatePipelines()
+    {
+        Flourish::ShaderCreateInfo shaderCreateInfo;
+        Flourish::GraphicsPipelineCreateInfo gpCreateInfo;
+        Flourish::ComputePipelineCreateInfo compCreateInfo;
+
+        shaderCreateInfo.Type = Flourish::ShaderTypeFlags::Compute;
+        shaderCreateInfo.Source = R"(
+            #version 460
+
+            layout (local_size_x = 1) in;
+
+            layout(binding = 0, set = 0) buffer DataBuffer {
+                vec4 data[];
+            } dataBuffer;
+
+            void main() {
+                dataBuffer.data[gl_GlobalInvocationID.x] = vec4(1.f);
+            }
+        )";
+        auto computeShader = Flourish::Shader::Create(shaderCreateInfo);
+
+        shaderCreateInfo.Type = Flourish::ShaderTypeFlags::Vertex;
+        shaderCreateInfo.Source = R"(
+            #version 460
+
+            void main() {
+                vec2 uv = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+                gl_Position = vec4(uv * 2.f - 1.f, 0.f, 1.f);
+            }
+        )";
+        auto vertShader = Flourish::Shader::Create(shaderCreateInfo);
+
+        shaderCreateInfo.Type = Flourish::ShaderTypeFlags::Fragment;
+        shaderCreateInfo.Source = R"(
+            #version 460
+
+            layout(location = 0) out vec4 outColor;
+
+            void main() {
+                outColor = vec4(1.f);
+            }
+        )";
+        auto fragShader = Flourish::Shader::Create(shaderCreateInfo);
+
+        compCreateInfo.Shader = { computeShader };
+        m_ComputePipeline = Flourish::ComputePipeline::Create(compCreateInfo);
+
+        gpCreateInfo.VertexShader = { vertShader };
+        gpCreateInfo.FragmentShader = { fragShader };
+        gpCreateInfo.VertexInput = false;
+        gpCreateInfo.VertexTopology = Flourish::VertexTopology::TriangleList;
+        gpCreateInfo.BlendStates = { { false } };
+        gpCreateInfo.DepthConfig.DepthTest = false;
+        gpCreateInfo.DepthConfig.DepthWrite = false;
+        gpCreateInfo.CullMode = Flourish::CullMode::None;
+        gpCreateInfo.WindingOrder = Flourish::WindingOrder::Clockwise;
+        m_RenderPass->CreatePipeline("draw", gpCreateInfo);
+
+        Flourish::ResourceSetCreateInfo descCreateInfo;
+        m_ComputeResourceSet = m_ComputePipeline->CreateResourceSet(0, descCreateInfo);
+    }
+
+    void Benchmarks::CreateBuffers()
+    {
+        Flourish::BufferCreateInfo bufCreateInfo;
+
+        // Resources referenced by graph nodes
+        bufCreateInfo.Usage = Flourish::BufferUsageFlags::Storage;
+        bufCreateInfo.MemoryType = Flourish::BufferMemoryType::GPUOnly;
+        bufCreateInfo.Layout = { { Flourish::BufferDataType::Float4 } };
+        bufCreateInfo.ElementCount = 64;
+        for (u32 i = 0; i < GraphBufferPoolSize; i++)
+            m_GraphBuffers.push_back(Flourish::Buffer::Create(bufCreateInfo));
+
+        m_StorageBuffer = Flourish::Buffer::Create(bufCreateInfo);
+
+        // Host visible upload target
+        bufCreateInfo.MemoryType = Flourish::BufferMemoryType::CPUWrite;
+        bufCreateInfo.Layout = {};
+        bufCreateInfo.Stride = UploadChunkSize;
+        bufCreateInfo.ElementCount = 1024;
+        m_UploadBuffer = Flourish::Buffer::Create(bufCreateInfo);
+    }
+
+    void Benchmarks::CreateFramebuffers()
+    {
+        Flourish::TextureCreateInfo texCreateInfo;
+        texCreateInfo.Width = 64;
+        texCreateInfo.Height = 64;
+        texCreateInfo.MipCount = 1;
+        texCreateInfo.Format = Flourish::ColorFormat::RGBA8_UNORM;
+        texCreateInfo.Usage = Flourish::TextureUsageFlags::Graphics;
+        texCreateInfo.SamplerState.AnisotropyEnable = false;
+        m_TargetTexture = Flourish::Texture::Create(texCreateInfo);
+
+        Flourish::FramebufferCreateInfo fbCreateInfo;
+        fbCreateInfo.RenderPass = m_RenderPass;
+        fbCreateInfo.Width = 64;
+        fbCreateInfo.Height = 64;
+        fbCreateInfo.ColorAttachments = { { { 0.f, 0.f, 0.f, 0.f }, m_TargetTexture } };
+        m_Framebuffer = Flourish::Framebuffer::Create(fbCreateInfo);
+    }
+}
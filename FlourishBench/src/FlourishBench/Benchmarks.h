@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Flourish/Api/Context.h"
+#include "Flourish/Api/CommandBuffer.h"
+#include "Flourish/Api/Buffer.h"
+#include "Flourish/Api/RenderPass.h"
+#include "Flourish/Api/Texture.h"
+#include "Flourish/Api/Framebuffer.h"
+#include "Flourish/Api/ResourceSet.h"
+#include "Flourish/Api/ComputePipeline.h"
+#include "Flourish/Api/RenderGraph.h"
+
+namespace FlourishBench
+{
+    struct BenchmarkConfig
+    {
+        u32 MaxSize = 100000;
+        u32 Iterations = 5;
+    };
+
+    struct BenchmarkResult
+    {
+        std::string Name;
+        u32 Size;
+        std::vector<u64> Samples; // Nanoseconds
+
+        u64 Min() const;
+        u64 Median() const;
+        u64 Mean() const;
+    };
+
+    class Benchmarks
+    {
+    public:
+        Benchmarks(const BenchmarkConfig& config);
+
+        void Run();
+        std::string ToJson() const;
+
+    private:
+        // Each function returns the timing for a single iteration of the workload
+        u64 RenderGraphBuild(u32 size);
+        u64 RenderGraphBuildDiamond(u32 size);
+        u64 RenderGraphRebuildUnchanged(u32 size);
+        u64 RenderGraphProcess(u32 size);
+        u64 ResourceSetFlush(u32 size);
+        u64 DrawRecording(u32 size);
+        u64 BufferSetBytes(u32 size);
+        u64 FinalizerIterate(u32 size);
+
+        void RunBenchmark(const char* name, u64 (Benchmarks::*func)(u32));
+        void EnsureCommandBuffers(u32 count);
+        void AdvanceFrames(u32 count);
+
+        void CreateRenderPasses();
+        void CreatePipelines();
+        void CreateBuffers();
+        void CreateFramebuffers();
+
+    private:
+        BenchmarkConfig m_Config;
+        std::vector<u32> m_Sizes;
+        std::vector<BenchmarkResult> m_Results;
+
+        std::vector<std::shared_ptr<Flourish::CommandBuffer>> m_CommandBuffers;
+        std::vector<std::shared_ptr<Flourish::Buffer>> m_GraphBuffers;
+        std::shared_ptr<Flourish::RenderGraph> m_RebuildGraph;
+        std::shared_ptr<Flourish::RenderPass> m_RenderPass;
+        std::shared_ptr<Flourish::Texture> m_TargetTexture;
+        std::shared_ptr<Flourish::Framebuffer> m_Framebuffer;
+        std::shared_ptr<Flourish::ComputePipeline> m_ComputePipeline;
+        std::shared_ptr<Flourish::ResourceSet> m_ComputeResourceSet;
+        std::shared_ptr<Flourish::Buffer> m_StorageBuffer;
+        std::shared_ptr<Flourish::Buffer> m_UploadBuffer;
+
+        static constexpr u32 GraphBufferPoolSize = 16;
+        static constexpr u32 DiamondWidth = 4;
+        static constexpr u32 UploadChunkSize = 64;
+    };
+}
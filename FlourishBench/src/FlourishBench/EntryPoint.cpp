@@ -0,0 +1,101 @@
+#include "flpch.h"
+
+#include "Flourish/Api/Context.h"
+#include "Flourish/Core/Log.h"
+
+#include "FlourishBench/Benchmarks.h"
+
+#include <cstring>
+
+static bool verbose = false;
+
+void Log(Flourish::LogLevel level, const char* message)
+{
+    // Logs go to stderr so that stdout only contains the json results
+    if (verbose || level >= Flourish::LogLevel::Warn)
+        fprintf(stderr, "FLOURISH: %s\n", message);
+}
+
+void PrintUsage()
+{
+    fprintf(
+        stderr,
+        "Usage: Bench [--max-size N] [--iterations N] [--output PATH] [--trace PATH] [--verbose]\n"
+        "  --max-size N     Largest workload size to run (default 100000)\n"
+        "  --iterations N   Timed iterations per workload size (default 5)\n"
+        "  --output PATH    Write json results to PATH instead of stdout\n"
+        "  --trace PATH     Record a Chrome trace of the run to PATH\n"
+        "  --verbose        Forward all library logs to stderr\n"
+    );
+}
+
+int main(int argc, char** argv)
+{
+    FlourishBench::BenchmarkConfig config;
+    const char* outputPath = nullptr;
+    const char* tracePath = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--max-size") && hasValue)
+            config.MaxSize = static_cast<u32>(strtoul(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--iterations") && hasValue)
+            config.Iterations = static_cast<u32>(strtoul(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            outputPath = argv[++i];
+        else if (!strcmp(argv[i], "--trace") && hasValue)
+            tracePath = argv[++i];
+        else if (!strcmp(argv[i], "--verbose"))
+            verbose = true;
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    Flourish::Logger::SetLogFunction(Log);
+
+    int result = 0;
+    try
+    {
+        Flourish::ContextInitializeInfo contextInitInfo;
+        contextInitInfo.Backend = Flourish::BackendType::Vulkan;
+        contextInitInfo.ApplicationName = "FlourishBench";
+        contextInitInfo.Headless = true;
+        Flourish::Context::Initialize(contextInitInfo);
+
+        if (tracePath)
+            Flourish::Profiler::StartRecording();
+
+        std::string json;
+        {
+            FlourishBench::Benchmarks benchmarks(config);
+            benchmarks.Run();
+            json = benchmarks.ToJson();
+        }
+
+        if (tracePath)
+        {
+            Flourish::Profiler::StopRecording();
+            Flourish::Profiler::WriteRecording(tracePath);
+        }
+
+        if (outputPath)
+        {
+            std::ofstream file(outputPath);
+            file << json;
+        }
+        else
+            fputs(json.c_str(), stdout);
+    }
+    catch (std::exception& e)
+    {
+        FL_LOG_ERROR("Crashed: %s", e.what());
+        result = 1;
+    }
+
+    Flourish::Context::Shutdown();
+
+    return result;
+}
@@ -38,6 +38,7 @@ namespace FlourishTesting
             if (m_RenderContext->Validate())
             {
                 //RunSingleThreadedTest();
+                //RunReadWriteHazardTest();
                 RunMultiThreadedTest();
             }
 
@@ -209,6 +210,63 @@ namespace FlourishTesting
         Flourish::Context::PushFrameRenderContext(m_RenderContext.get());
     }
 
+    // A pass that samples a texture followed by one on the same queue that both reads and writes it. The
+    // write must still wait on the earlier sampling, which the synchronization validation layer reports otherwise
+    void Tests::RunReadWriteHazardTest()
+    {
+        if (!m_DogTexture->IsReady()) return;
+
+        auto encoder1 = m_CommandBuffers[0]->EncodeRenderCommands(m_FrameTextureBuffers[1].get());
+        encoder1->BindPipeline("simple_image");
+        m_FrameDescriptorSet->BindTexture(0, m_FrameTextures[0]);
+        m_FrameDescriptorSet->FlushBindings();
+        encoder1->BindResourceSet(m_FrameDescriptorSet.get(), 0);
+        encoder1->FlushResourceSet(0);
+        encoder1->BindVertexBuffer(m_FullTriangleVertices.get());
+        encoder1->Draw(3, 0, 1, 0);
+        encoder1->EndEncoding();
+
+        auto encoder2 = m_CommandBuffers[1]->EncodeRenderCommands(m_FrameTextureBuffers[0].get());
+        encoder2->BindPipeline("simple_image");
+        encoder2->BindResourceSet(m_DogDescriptorSet.get(), 0);
+        encoder2->FlushResourceSet(0);
+        encoder2->BindVertexBuffer(m_FullTriangleVertices.get());
+        encoder2->Draw(3, 0, 1, 0);
+        encoder2->EndEncoding();
+
+        auto frameEncoder = m_RenderContext->EncodeRenderCommands();
+        frameEncoder->BindPipeline("main");
+        m_FrameDescriptorSet->BindTexture(0, m_FrameTextures[1]);
+        m_FrameDescriptorSet->FlushBindings();
+        frameEncoder->BindResourceSet(m_FrameDescriptorSet.get(), 0);
+        frameEncoder->FlushResourceSet(0);
+        frameEncoder->BindVertexBuffer(m_FullTriangleVertices.get());
+        frameEncoder->Draw(3, 0, 1, 0);
+        frameEncoder->EndEncoding();
+
+        if (!m_RenderGraph->IsBuilt())
+        {
+            m_RenderGraph->ConstructNewNode(m_CommandBuffers[0].get())
+                .AddEncoderNode(Flourish::GPUWorkloadType::Graphics)
+                .EncoderAddTextureRead(m_FrameTextures[0].get(), Flourish::RenderGraphResourceAccessType::Sampled, Flourish::ShaderTypeFlags::Fragment)
+                .EncoderAddTextureWrite(m_FrameTextures[1].get(), Flourish::RenderGraphResourceAccessType::ColorAttachment)
+                .AddToGraph();
+
+            // Loads and stores the texture the previous pass sampled
+            m_RenderGraph->ConstructNewNode(m_CommandBuffers[1].get())
+                .AddExecutionDependency(m_CommandBuffers[0].get())
+                .AddEncoderNode(Flourish::GPUWorkloadType::Graphics)
+                .EncoderAddTextureRead(m_FrameTextures[0].get(), Flourish::RenderGraphResourceAccessType::ColorAttachment)
+                .EncoderAddTextureWrite(m_FrameTextures[0].get(), Flourish::RenderGraphResourceAccessType::ColorAttachment)
+                .AddToGraph();
+
+            m_RenderGraph->Build();
+        }
+
+        Flourish::Context::PushFrameRenderGraph(m_RenderGraph.get());
+        Flourish::Context::PushFrameRenderContext(m_RenderContext.get());
+    }
+
     Tests::Tests()
     {
         Flourish::RenderContextCreateInfo contextCreateInfo;
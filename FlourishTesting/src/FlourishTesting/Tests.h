@@ -36,6 +36,7 @@ namespace FlourishTesting
     private:
         void RunMultiThreadedTest();
         void RunSingleThreadedTest();
+        void RunReadWriteHazardTest();
 
         void CreateRenderPasses();
         void CreatePipelines();